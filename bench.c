@@ -0,0 +1,177 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+// The allocations of the library are counted by wrapping the standard allocators before including it.
+static size_t bench_allocations = 0;
+
+static void *bench_malloc(const size_t size) { return ++bench_allocations, malloc(size); }
+
+static void *bench_calloc(const size_t n, const size_t size) { return ++bench_allocations, calloc(n, size); }
+
+static void *bench_realloc(void *ptr, const size_t size) { return ++bench_allocations, realloc(ptr, size); }
+
+#define malloc(size) bench_malloc(size)
+#define calloc(n, size) bench_calloc(n, size)
+#define realloc(ptr, size) bench_realloc(ptr, size)
+
+#include "big-num.c"
+
+#undef malloc
+#undef calloc
+#undef realloc
+
+// The benchmark sweeps the operand sizes from 64 bits (doubling each time) for every operation, it reports the time
+// per operation, the word operations per second (estimated from the textbook complexity, with 31-bit words) and the
+// allocations per operation. An operation stops growing when its next size is predicted to exceed the time limit.
+
+typedef struct {
+	cint_sheet *sheet;
+	cint A, B, C, D, E;
+	char *str;
+	size_t bits;
+	uint64_t seed;
+} bench_state;
+
+typedef struct {
+	const char *name;
+	void (*prepare)(bench_state *); // creates the operands (not timed)
+	void (*run)(bench_state *);     // the timed operation
+	double (*word_ops)(const bench_state *);
+} bench_operation;
+
+static double bench_words(const size_t bits) { return (double) bits / (double) cint_exponent + 1; }
+
+static void prepare_two(bench_state *s) {
+	cint_random_bits(&s->A, s->bits, &s->seed), cint_random_bits(&s->B, s->bits, &s->seed);
+	*s->A.mem |= 1, *s->B.mem |= 1;
+}
+
+static void prepare_div(bench_state *s) { cint_random_bits(&s->A, 2 * s->bits, &s->seed), cint_random_bits(&s->B, s->bits, &s->seed); }
+
+static void prepare_pow_mod(bench_state *s) {
+	prepare_two(s), cint_random_bits(&s->C, s->bits, &s->seed);
+	*s->C.mem |= 1;
+}
+
+static void prepare_is_prime(bench_state *s) {
+	// an odd number without small factor, so the timing covers a round of Miller-Rabin.
+	do cint_random_bits(&s->A, s->bits, &s->seed), *s->A.mem |= 1;
+	while (h_cint_is_prime_easy(&s->A) >= 0);
+}
+
+static void prepare_sqrt(bench_state *s) { cint_random_bits(&s->A, 2 * s->bits, &s->seed); }
+
+static void prepare_string(bench_state *s) {
+	cint_random_bits(&s->A, s->bits, &s->seed);
+	free(s->str), s->str = cint_to_string(&s->A, 10);
+}
+
+static void prepare_factorial(bench_state *s) {
+	// the smallest "n" whose factorial has the requested bits.
+	double bits = 0;
+	cint_reinit(&s->B, 1);
+	while (bits < (double) s->bits) ++*s->B.mem, bits += log2((double) *s->B.mem);
+}
+
+static void run_mul(bench_state *s) { cint_mul(&s->A, &s->B, &s->C); }
+
+static void run_div(bench_state *s) { cint_div(s->sheet, &s->A, &s->B, &s->C, &s->D); }
+
+static void run_pow_modi(bench_state *s) { cint_dup(&s->D, &s->A), cint_pow_modi(s->sheet, &s->D, &s->B, &s->C); }
+
+static void run_is_prime(bench_state *s) { cint_is_prime(s->sheet, &s->A, 1, &s->seed); }
+
+static void run_gcd(bench_state *s) { cint_gcd(s->sheet, &s->A, &s->B, &s->C); }
+
+static void run_binary_gcd(bench_state *s) { cint_binary_gcd(s->sheet, &s->A, &s->B, &s->C); }
+
+static void run_sqrt(bench_state *s) { cint_sqrt(s->sheet, &s->A, &s->C, &s->D); }
+
+static void run_to_string(bench_state *s) { free(cint_to_string(&s->A, 10)); }
+
+static void run_reinit_by_string(bench_state *s) { cint_reinit_by_string(&s->C, s->str, 10); }
+
+static void run_factorial(bench_state *s) { cint_factorial(s->sheet, (unsigned) *s->B.mem, &s->C); }
+
+static double ops_quadratic(const bench_state *s) { return bench_words(s->bits) * bench_words(s->bits); }
+
+static double ops_cubic(const bench_state *s) { return bench_words(s->bits) * bench_words(s->bits) * (double) s->bits; }
+
+static double ops_factorial(const bench_state *s) { return bench_words(s->bits) * (double) *s->B.mem; }
+
+static double bench_now(void) { return (double) clock() / CLOCKS_PER_SEC; }
+
+int main(int argc, char *argv[]) {
+	size_t max_bits = (size_t) 1 << 21;
+	double min_time = 0.2, max_time = 2.0;
+	int json = 0;
+	for (int i = 1; i < argc; ++i)
+		if (!strcmp(argv[i], "--json")) json = 1;
+		else if (!strcmp(argv[i], "--max-bits") && i + 1 < argc) max_bits = strtoull(argv[++i], 0, 10);
+		else if (!strcmp(argv[i], "--min-time") && i + 1 < argc) min_time = strtod(argv[++i], 0);
+		else if (!strcmp(argv[i], "--max-time") && i + 1 < argc) max_time = strtod(argv[++i], 0);
+		else return fprintf(stderr, "Usage: %s [--json] [--max-bits N] [--min-time SECONDS] [--max-time SECONDS]\n", argv[0]), 1;
+
+	const bench_operation operations[] = {
+			{"mul",               prepare_two,       run_mul,              ops_quadratic},
+			{"div",               prepare_div,       run_div,              ops_quadratic},
+			{"pow_modi",          prepare_pow_mod,   run_pow_modi,         ops_cubic},
+			{"is_prime",          prepare_is_prime,  run_is_prime,         ops_cubic},
+			{"gcd",               prepare_two,       run_gcd,              ops_quadratic},
+			{"binary_gcd",        prepare_two,       run_binary_gcd,       ops_quadratic},
+			{"sqrt",              prepare_sqrt,      run_sqrt,             ops_quadratic},
+			{"to_string",         prepare_string,    run_to_string,        ops_quadratic},
+			{"reinit_by_string",  prepare_string,    run_reinit_by_string, ops_quadratic},
+			{"factorial",         prepare_factorial, run_factorial,        ops_factorial},
+	};
+
+	bench_state s = {0};
+	s.seed = 0x5851f42d4c957f2d;
+	s.sheet = cint_new_sheet(1024);
+	cint *nums[] = {&s.A, &s.B, &s.C, &s.D, &s.E};
+
+	if (json) printf("[\n");
+	else printf("operation,bits,iterations,ns_per_op,word_ops_per_s,allocs_per_op\n");
+	int first = 1;
+	for (size_t op = 0; op < sizeof(operations) / sizeof(*operations); ++op) {
+		double previous = 0, growth = 8;
+		for (s.bits = 64; s.bits <= max_bits; s.bits <<= 1) {
+			if (previous * growth > max_time) break;
+			for (size_t i = 0; i < sizeof(nums) / sizeof(*nums); ++i)
+				cint_init(nums[i], 4 * s.bits + 256, 0);
+			operations[op].prepare(&s);
+			// a first call warms the sheet, then the operation is repeated during at least "min_time".
+			operations[op].run(&s);
+			size_t iterations = 0;
+			const size_t allocations = bench_allocations;
+			const double start = bench_now();
+			double elapsed;
+			do operations[op].run(&s), ++iterations;
+			while ((elapsed = bench_now() - start) < min_time);
+			const double per_op = elapsed / (double) iterations;
+			if (previous > 0) growth = per_op / previous;
+			if (growth < 2) growth = 2;
+			previous = per_op;
+			const double allocs = (double) (bench_allocations - allocations) / (double) iterations;
+			const double word_ops = operations[op].word_ops(&s) / per_op;
+			if (json)
+				printf("%s  {\"operation\": \"%s\", \"bits\": %zu, \"iterations\": %zu, \"ns_per_op\": %.1f, \"word_ops_per_s\": %.4g, \"allocs_per_op\": %.2f}", first ? "" : ",\n", operations[op].name, s.bits, iterations, per_op * 1e9, word_ops, allocs);
+			else
+				printf("%s,%zu,%zu,%.1f,%.4g,%.2f\n", operations[op].name, s.bits, iterations, per_op * 1e9, word_ops, allocs);
+			fflush(stdout);
+			first = 0;
+			for (size_t i = 0; i < sizeof(nums) / sizeof(*nums); ++i)
+				free(nums[i]->mem);
+		}
+	}
+	if (json) printf("\n]\n");
+
+	free(s.str);
+	cint_clear_sheet(s.sheet);
+	return 0;
+}
+
+// Compilation is done using "gcc -O2 -std=c99 bench.c -o bench -lm"
@@ -5,6 +5,14 @@
 #include <stdlib.h>
 #include <assert.h>
 #include <string.h>
+#include <stdio.h>
+#include <float.h>
+#ifdef CINT_THREADS
+#include <pthread.h>
+#endif
+#ifdef CINT_THRESHOLDS
+#include "cint-thresholds.h" // the thresholds of the host, generated by "tune.c".
+#endif
 
 // The tiny Big Integer Library (released "as is", into the public domain, without any warranty, express or implied)
 // is provided for handling large integers. It includes basic and advanced mathematical functions to support calculations.
@@ -16,6 +24,9 @@
 // the functions name that begin by "h_" means intended for internal usage.
 
 typedef int64_t h_cint_t; // worked with short, int, long, etc.
+#ifdef __SIZEOF_INT128__
+__extension__ typedef unsigned __int128 h_cint_u128; // the native double word, for the fast paths.
+#endif
 
 static const h_cint_t cint_exponent = 4 * sizeof(h_cint_t) - 1;
 static const h_cint_t cint_base = (int64_t) 1 << (4 * sizeof(int64_t) - 1);
@@ -31,18 +42,42 @@ typedef struct {
 	size_t size;    // The allocated size (greater than or equal to end - mem)
 } cint;
 
+#ifdef CINT_INSTRUMENT
+// The instrumentation (compiled with -DCINT_INSTRUMENT) records into the sheet the calls, the cycles (inclusive of the
+// nested calls) and a histogram of the operand sizes of the main functions, and it calls the hooks of the user at
+// the beginning and at the end of every recorded call. Without the macro, it compiles to nothing.
+#include <time.h>
+
+enum {
+	CINT_STAT_MUL, CINT_STAT_DIV, CINT_STAT_DIV_STEP, CINT_STAT_TMP_RESCALE, CINT_STAT_MUL_MOD, CINT_STAT_POW_MOD,
+	CINT_STAT_GCD, CINT_STAT_SQRT, CINT_STAT_MODULAR_INVERSE, CINT_STAT_IS_PRIME, CINT_STAT_COUNT
+};
+
+#define CINT_STAT_HISTOGRAM 24 // the operands of 2^k to 2^(k + 1) - 1 words are counted in the bucket k.
+
+typedef struct {
+	uint64_t calls[CINT_STAT_COUNT], cycles[CINT_STAT_COUNT], sizes[CINT_STAT_COUNT][CINT_STAT_HISTOGRAM];
+	void (*begin)(void *data, int stat, size_t words);
+	void (*end)(void *data, int stat, uint64_t cycles);
+	void *data;
+} cint_stats;
+#endif
+
 typedef struct {
 	cint temp[10];
+#ifdef CINT_INSTRUMENT
+	cint_stats stats;
+#endif
 } cint_sheet;
 
 static cint_sheet *cint_new_sheet(const size_t bits) {
 	// a computation sheet is required by function needing temporary vars.
-	cint_sheet *sheet = calloc(1, sizeof(cint_sheet));
+	cint_sheet *sheet = (cint_sheet *) calloc(1, sizeof(cint_sheet));
 	assert(sheet);
 	const size_t x = bits / cint_exponent, num_size = x + 8 - x % 4;
 	for (size_t i = 0; i < sizeof(sheet->temp) / sizeof(*sheet->temp); ++i) {
 		sheet->temp[i].nat = 1;
-		sheet->temp[i].mem = sheet->temp[i].end = calloc(num_size, sizeof(h_cint_t));
+		sheet->temp[i].mem = sheet->temp[i].end = (h_cint_t *) calloc(num_size, sizeof(h_cint_t));
 		assert(sheet->temp[i].mem);
 		sheet->temp[i].size = num_size;
 	}
@@ -55,6 +90,69 @@ static void cint_clear_sheet(cint_sheet *sheet) {
 	free(sheet);
 }
 
+#ifdef CINT_INSTRUMENT
+static const char *cint_stat_names[CINT_STAT_COUNT] = {
+		"mul", "div", "div_step", "tmp_rescale", "mul_mod", "pow_mod", "gcd", "sqrt", "modular_inverse", "is_prime"
+};
+
+static inline cint_sheet *cint_thread_sheet(void); // the functions without sheet record into the sheet of the thread.
+
+static inline uint64_t h_cint_cycles(void) {
+#if defined(__x86_64__) || defined(__i386__)
+	return __builtin_ia32_rdtsc();
+#else
+	return (uint64_t) clock();
+#endif
+}
+
+static inline uint64_t h_cint_stat_begin(cint_sheet *sheet, const int stat, const cint *num) {
+	cint_stats *s = &sheet->stats;
+	const size_t words = num->end - num->mem;
+	size_t bucket = 0;
+	while (words >> bucket > 1 && bucket < CINT_STAT_HISTOGRAM - 1) ++bucket;
+	++s->calls[stat], ++s->sizes[stat][bucket];
+	if (s->begin) s->begin(s->data, stat, words);
+	return h_cint_cycles();
+}
+
+static inline void h_cint_stat_end(cint_sheet *sheet, const int stat, const uint64_t start) {
+	const uint64_t cycles = h_cint_cycles() - start;
+	sheet->stats.cycles[stat] += cycles;
+	if (sheet->stats.end) sheet->stats.end(sheet->stats.data, stat, cycles);
+}
+
+#define H_CINT_BEGIN(sheet, stat, num) const uint64_t h_cint_start = h_cint_stat_begin(sheet, stat, num)
+#define H_CINT_END(sheet, stat) h_cint_stat_end(sheet, stat, h_cint_start)
+#define H_CINT_COUNT(sheet, stat) ++(sheet)->stats.calls[stat]
+
+__attribute__((unused)) static void cint_set_hooks(cint_sheet *sheet, void (*begin)(void *, int, size_t), void (*end)(void *, int, uint64_t), void *data) {
+	// install the functions called at the beginning (with the operand words) and at the end (with the cycles) of the recorded calls.
+	sheet->stats.begin = begin, sheet->stats.end = end, sheet->stats.data = data;
+}
+
+__attribute__((unused)) static void cint_reset_stats(cint_sheet *sheet) {
+	memset(sheet->stats.calls, 0, sizeof(sheet->stats.calls));
+	memset(sheet->stats.cycles, 0, sizeof(sheet->stats.cycles));
+	memset(sheet->stats.sizes, 0, sizeof(sheet->stats.sizes));
+}
+
+__attribute__((unused)) static void cint_dump_stats(const cint_sheet *sheet, FILE *out) {
+	// one line per recorded function: its name, calls, cycles, then the non-empty buckets as "words:calls".
+	for (int i = 0; i < CINT_STAT_COUNT; ++i)
+		if (sheet->stats.calls[i]) {
+			fprintf(out, "%-16s %12llu calls %16llu cycles ", cint_stat_names[i], (unsigned long long) sheet->stats.calls[i], (unsigned long long) sheet->stats.cycles[i]);
+			for (int j = 0; j < CINT_STAT_HISTOGRAM; ++j)
+				if (sheet->stats.sizes[i][j])
+					fprintf(out, " %llu:%llu", 1ULL << j, (unsigned long long) sheet->stats.sizes[i][j]);
+			fputc('\n', out);
+		}
+}
+#else
+#define H_CINT_BEGIN(sheet, stat, num) (void) 0
+#define H_CINT_END(sheet, stat) (void) 0
+#define H_CINT_COUNT(sheet, stat) (void) 0
+#endif
+
 __attribute__((unused)) static uint64_t cint_checksum(const cint *num) {
 	//  provide a checksum of the number that fit into a machine word.
 	uint64_t sum = 0x2236b69a7d223bd ^ (num->end - num->mem) * num->nat;
@@ -74,22 +172,42 @@ __attribute__((unused)) static inline void cint_negate(cint *num) {
 	num->nat *= 1 - ((num->mem != num->end) << 1);
 }
 
-static size_t cint_count_bits(const cint *num) {
+// the bits of a word, by the instructions of the processor when the compiler exposes them.
+#ifdef __GNUC__
+static inline size_t h_cint_word_bits(const h_cint_t w) { return 64 - __builtin_clzll((unsigned long long) w); } // w != 0
+
+static inline size_t h_cint_word_zeros(const h_cint_t w) { return __builtin_ctzll((unsigned long long) w); } // w != 0
+
+static inline size_t h_cint_word_ones(const h_cint_t w) { return __builtin_popcountll((unsigned long long) w); }
+#else
+static inline size_t h_cint_word_bits(const h_cint_t w) {
 	size_t res = 0;
-	if (num->end != num->mem) {
-		for (; *(num->end - 1) >> ++res;);
-		res += (num->end - num->mem - 1) * cint_exponent;
-	}
+	for (; w >> res; ++res);
+	return res;
+}
+
+static inline size_t h_cint_word_zeros(const h_cint_t w) {
+	size_t res = 0;
+	for (; !(w >> res & 1); ++res);
+	return res;
+}
+
+static inline size_t h_cint_word_ones(h_cint_t w) {
+	size_t res = 0;
+	for (; w; w &= w - 1, ++res);
 	return res;
 }
+#endif
+
+static size_t cint_count_bits(const cint *num) {
+	return num->end == num->mem ? 0 : (num->end - num->mem - 1) * cint_exponent + h_cint_word_bits(*(num->end - 1));
+}
 
 static size_t cint_count_zeros(const cint *num) {
 	// examine the binary representation of the number to count trailing zeros.
-	size_t res = 0, i;
-	h_cint_t *ptr;
-	for (ptr = num->mem; ptr < num->end && !*ptr; ++ptr, res += cint_exponent);
-	for (i = 0; !(*ptr >> i & 1); ++i);
-	return res + i;
+	const h_cint_t *ptr = num->mem;
+	for (; ptr < num->end && !*ptr; ++ptr);
+	return (ptr - num->mem) * cint_exponent + (ptr < num->end ? h_cint_word_zeros(*ptr) : 0);
 }
 
 static inline int cint_compare_char(const cint *lhs, const char rhs) {
@@ -115,14 +233,14 @@ static inline int cint_compare(const cint *lhs, const cint *rhs) {
 static void cint_init(cint *num, size_t bits, long long int val) {
 	num->size = bits / cint_exponent;
 	num->size += 8 - num->size % 4;
-	num->end = num->mem = calloc(num->size, sizeof(*num->mem));
+	num->end = num->mem = (h_cint_t *) calloc(num->size, sizeof(*num->mem));
 	assert(num->mem);
 	if ((num->nat = 1 - ((val < 0) << 1)) < 0) val = -val;
 	for (; val; *num->end++ = (h_cint_t) (val % cint_base), val /= cint_base);
 }
 
 static inline void cint_erase(cint *num) {
-	num->nat = 1, num->end = memset(num->mem, 0, (size_t) (num->end - num->mem) * sizeof(h_cint_t));
+	num->nat = 1, num->end = (h_cint_t *) memset(num->mem, 0, (size_t) (num->end - num->mem) * sizeof(h_cint_t));
 }
 
 static void cint_reinit(cint *num, long long int val) {
@@ -132,6 +250,22 @@ static void cint_reinit(cint *num, long long int val) {
 	for (; val; *num->end = (h_cint_t) (val % cint_base), val /= cint_base, ++num->end);
 }
 
+static inline uint64_t h_cint_to_u64(const cint *num) {
+	// the absolute value of a number having at most two words, for the native fast paths.
+	return (uint64_t) *num->mem | (uint64_t) *(num->mem + 1) << cint_exponent;
+}
+
+static inline void h_cint_reinit_u64(cint *num, uint64_t val) {
+	cint_erase(num);
+	for (; val; *num->end++ = (h_cint_t) (val & cint_mask), val >>= cint_exponent);
+}
+
+static inline void h_cint_write_u64(cint *num, const uint64_t val) {
+	// same as above for a number having at most three words, it overwrites them all instead of erasing.
+	*num->mem = (h_cint_t) (val & cint_mask), *(num->mem + 1) = (h_cint_t) (val >> cint_exponent & cint_mask), *(num->mem + 2) = (h_cint_t) (val >> 2 * cint_exponent);
+	num->end = num->mem + (val >> 2 * cint_exponent ? 3 : val >> cint_exponent ? 2 : val != 0);
+}
+
 static void cint_reinit_by_string(cint *num, const char *str, const int base) {
 	cint_erase(num);
 	for (; *str && memchr(cint_alpha, *str, base) == 0; num->nat *= 1 - ((*str++ == '-') << 1));
@@ -145,42 +279,6 @@ __attribute__((unused)) static inline void cint_init_by_string(cint *num, const
 	cint_init(num, bits, 0), cint_reinit_by_string(num, str, base);
 }
 
-static void cint_reinit_by_double(cint *num, const double value) {
-	// sometimes tested against Microsoft STL, it worked.
-	cint_erase(num);
-	uint64_t memory;
-	memcpy(&memory, &value, sizeof(value));
-	uint64_t ex = (memory << 1 >> 53) - 1023, m_1 = 1ULL << 52;
-	if (ex < 1024) {
-		h_cint_t m_2 = 1 << ex % cint_exponent;
-		num->nat *= (value > 0) - (value < 0);
-		num->end = 1 + num->mem + ex / cint_exponent;
-		h_cint_t *n = num->end;
-		for (*(n - 1) |= m_2; --n >= num->mem; m_2 = cint_base)
-			for (; m_2 >>= 1;)
-				if (m_1 >>= 1)
-					*n |= m_2 * ((memory & m_1) != 0);
-				else return;
-	}
-}
-
-__attribute__((unused)) static double cint_to_double(const cint *num) {
-	// sometimes tested, it worked.
-	uint64_t memory = cint_count_bits(num) + 1022, m_write = 1ULL << 52, m_read = 1 << memory % cint_exponent;
-	double res = 0;
-	memory <<= 52;
-	for (h_cint_t *n = num->end; --n >= num->mem; m_read = 1LL << cint_exponent)
-		for (; m_read >>= 1;)
-			if (m_write >>= 1)
-				memory |= m_write * ((*n & m_read) != 0);
-			else
-				n = num->mem, m_read = 0;
-	memcpy(&res, &memory, sizeof(memory));
-	return (double) num->nat * res;
-}
-
-__attribute__((unused)) static inline void cint_init_by_double(cint *num, const size_t size, const double value) { cint_init(num, size, 0), cint_reinit_by_double(num, value); }
-
 static void cint_dup(cint *to, const cint *from) {
 	// duplicate number (no verification about overlapping or available memory, caller must check)
 	const size_t b = from->end - from->mem, a = to->end - to->mem;
@@ -196,14 +294,14 @@ static void cint_rescale(cint *num, const size_t bits) {
 	new_size = new_size + 8 - new_size % 8;
 	const size_t curr_length = num->end - num->mem;
 	if (num->size < new_size) {
-		num->mem = realloc(num->mem, new_size * sizeof(h_cint_t));
+		num->mem = (h_cint_t *) realloc(num->mem, new_size * sizeof(h_cint_t));
 		assert(num->mem);
 		memset(num->mem + num->size, 0, (size_t) (new_size - num->size) * sizeof(h_cint_t));
 		num->end = num->mem + curr_length;
 		num->size = new_size;
 	} else if (curr_length >= new_size) {
 		cint_erase(num); // can't keep the number when reducing its size under the minimal size it needs.
-		num->end = num->mem = realloc(num->mem, (num->size = new_size) * sizeof(h_cint_t));
+		num->end = num->mem = (h_cint_t *) realloc(num->mem, (num->size = new_size) * sizeof(h_cint_t));
 		assert(num->mem); // realloc can fail on trimming.
 	}
 }
@@ -211,8 +309,11 @@ static void cint_rescale(cint *num, const size_t bits) {
 static inline cint *h_cint_tmp(cint_sheet *sheet, const int id, const cint *least) {
 	// request at least the double of "least" to allow performing multiplication then modulo...
 	const size_t needed_size = (1 + least->end - least->mem) << 1;
-	if (sheet->temp[id].size < needed_size)
+	if (sheet->temp[id].size < needed_size) {
+		H_CINT_BEGIN(sheet, CINT_STAT_TMP_RESCALE, least);
 		cint_rescale(&sheet->temp[id], (1 + (cint_count_bits(least) >> 4)) << 5);
+		H_CINT_END(sheet, CINT_STAT_TMP_RESCALE);
+	}
 	return &sheet->temp[id];
 }
 
@@ -229,25 +330,40 @@ static void h_cint_addi(cint *lhs, const cint *rhs) {
 
 static void h_cint_subi(cint *lhs, const cint *rhs) {
 	// perform a subtraction (without caring about the sign, it performs high subtract low)
-	h_cint_t a = 0, cmp, *l, *r, *e, *o;
+	h_cint_t a = 0, cmp, *l, *f, *r, *e, *o;
 	if (lhs->mem == lhs->end)
 		cint_dup(lhs, rhs);
 	else if (rhs->mem != rhs->end) {
 		cmp = h_cint_compare(lhs, rhs);
 		if (cmp) {
-			if (cmp < 0) l = lhs->mem, r = rhs->mem, e = rhs->end, lhs->nat = -lhs->nat;
-			else l = rhs->mem, r = lhs->mem, e = lhs->end;
-			for (o = lhs->mem; r < e; *o = *r++ - *l++ - a, a = (*o & cint_base) != 0, *o++ &= cint_mask);
+			if (cmp < 0) l = lhs->mem, f = lhs->end, r = rhs->mem, e = rhs->end, lhs->nat = -lhs->nat;
+			else l = rhs->mem, f = rhs->end, r = lhs->mem, e = lhs->end;
+			// the low number is read up to its end only, the memory of the operands may differ in size.
+			for (o = lhs->mem; l < f; *o = *r++ - *l++ - a, a = (*o & cint_base) != 0, *o++ &= cint_mask);
+			for (; r < e; *o = *r++ - a, a = (*o & cint_base) != 0, *o++ &= cint_mask);
 			for (*o &= cint_mask, o += a; --o > lhs->mem && !*o;);
 			lhs->end = 1 + o;
 		} else cint_erase(lhs);
 	}
 }
 
+static inline void h_cint_addi_native(cint *lhs, const cint *rhs, const h_cint_t rhs_nat) {
+	// the signed addition of numbers having at most two words, the result fits a machine word.
+	const int64_t res = (int64_t) h_cint_to_u64(lhs) * lhs->nat + (int64_t) h_cint_to_u64(rhs) * rhs_nat;
+	h_cint_write_u64(lhs, (uint64_t) (res < 0 ? -res : res));
+	lhs->nat = res < 0 ? -1 : 1;
+}
+
 // regular functions, they care of the input sign
-static inline void cint_addi(cint *lhs, const cint *rhs) { lhs->nat == rhs->nat ? h_cint_addi(lhs, rhs) : h_cint_subi(lhs, rhs); }
+static inline void cint_addi(cint *lhs, const cint *rhs) {
+	if (lhs->end <= lhs->mem + 2 && rhs->end <= rhs->mem + 2) h_cint_addi_native(lhs, rhs, rhs->nat);
+	else lhs->nat == rhs->nat ? h_cint_addi(lhs, rhs) : h_cint_subi(lhs, rhs);
+}
 
-static inline void cint_subi(cint *lhs, const cint *rhs) { lhs->nat == rhs->nat ? lhs->nat = -lhs->nat, h_cint_subi(lhs, rhs), lhs->mem == lhs->end || (lhs->nat = -lhs->nat), (void) 0 : h_cint_addi(lhs, rhs); }
+static inline void cint_subi(cint *lhs, const cint *rhs) {
+	if (lhs->end <= lhs->mem + 2 && rhs->end <= rhs->mem + 2) h_cint_addi_native(lhs, rhs, -rhs->nat);
+	else lhs->nat == rhs->nat ? lhs->nat = -lhs->nat, h_cint_subi(lhs, rhs), lhs->mem == lhs->end || (lhs->nat = -lhs->nat), (void) 0 : h_cint_addi(lhs, rhs);
+}
 
 static inline void cint_add(const cint *lhs, const cint *rhs, cint *res) { cint_dup(res, lhs), cint_addi(res, rhs); }
 
@@ -279,18 +395,151 @@ static void cint_right_shifti(cint *num, const size_t bits) {
 	} else cint_erase(num);
 }
 
+// the floating-point conversions work a word at a time, the scalings by powers of two are exact.
+
+static void h_cint_reinit_by_float(cint *num, long double value) {
+	// the integer part of the value, the infinities and NaN give zero.
+	cint_erase(num);
+	if (value - value != 0) return;
+	if (value < 0) num->nat = -1, value = -value;
+	size_t top = 0;
+	for (; value >= cint_base; value /= cint_base, ++top);
+	if (value < 1) num->nat = 1;
+	else
+		for (h_cint_t *p = num->end = num->mem + top + 1; p-- > num->mem; value = (value - (long double) *p) * cint_base)
+			*p = (h_cint_t) value;
+}
+
+static inline h_cint_t h_cint_word_at(const cint *num, const size_t bit) {
+	// the 31 bits of the absolute value from the given one.
+	const size_t w = bit / cint_exponent, b = bit % cint_exponent, n = num->end - num->mem;
+	const h_cint_t lo = w < n ? num->mem[w] : 0, hi = w + 1 < n ? num->mem[w + 1] : 0;
+	return (lo >> b | hi << (cint_exponent - b)) & cint_mask;
+}
+
+static long double h_cint_to_float(const cint *num, const size_t digits, const size_t max_exp) {
+	// the value rounded to nearest (ties to even) with "digits" bits of mantissa, from the "digits + 2" highest bits,
+	// their lowest one also receives the bits below (sticky), then the rounding is an addition.
+	const size_t bits = cint_count_bits(num), s = bits > digits + 2 ? bits - digits - 2 : 0;
+	h_cint_t words[8] = {0}, *p = words;
+	for (size_t bit = s; bit < bits; bit += cint_exponent) *p++ = h_cint_word_at(num, bit);
+	if (s) {
+		const h_cint_t *q = num->mem;
+		for (; q < num->mem + s / cint_exponent && !*q; ++q);
+		*words |= q < num->mem + s / cint_exponent || num->mem[s / cint_exponent] & (((h_cint_t) 1 << s % cint_exponent) - 1);
+		// the 2 extra bits are the rounding bit and the sticky bit, the result keeps the "digits" highest ones.
+		const h_cint_t up = (*words & 2) && (*words & 5);
+		*words = (*words & ~(h_cint_t) 3) + 4 * up;
+	}
+	long double res = 0;
+	while (p > words) res = res * cint_base + (long double) *--p;
+	size_t e = s < max_exp + 2 ? s : max_exp + 2; // the infinity is reached anyway.
+	for (; e >= (size_t) cint_exponent; e -= cint_exponent) res *= cint_base;
+	return (long double) num->nat * res * (long double) ((h_cint_t) 1 << e);
+}
+
+static void cint_reinit_by_double(cint *num, const double value) {
+	// the integer part of the value, from the mantissa and the exponent of the IEEE 754 format.
+	uint64_t memory;
+	memcpy(&memory, &value, sizeof(value));
+	const int ex = (int) (memory >> 52 & 0x7ff) - 1075; // |value| = mantissa * 2^ex
+	uint64_t mantissa = (memory & ((1ULL << 52) - 1)) | 1ULL << 52;
+	cint_erase(num);
+	if (ex < -52 || ex == 0x7ff - 1075) return; // |value| < 1, the infinities and NaN give zero
+	h_cint_reinit_u64(num, ex < 0 ? mantissa >> -ex : mantissa);
+	if (ex > 0) cint_left_shifti(num, (size_t) ex);
+	num->nat = memory >> 63 ? -1 : 1;
+}
+
+__attribute__((unused)) static inline void cint_reinit_by_long_double(cint *num, const long double value) { h_cint_reinit_by_float(num, value); }
+
+__attribute__((unused)) static inline double cint_to_double(const cint *num) { return (double) h_cint_to_float(num, DBL_MANT_DIG, DBL_MAX_EXP); }
+
+__attribute__((unused)) static inline long double cint_to_long_double(const cint *num) { return h_cint_to_float(num, LDBL_MANT_DIG, LDBL_MAX_EXP); }
+
+__attribute__((unused)) static double cint_log2_approx(const cint *num) {
+	// the binary logarithm of the absolute value (0 for 0), from its 62 highest bits: log2(m * 2^e) where m is in
+	// [0.707, 1.414], by the series of atanh (the relative error is about 1e-16).
+	const size_t bits = cint_count_bits(num);
+	if (bits == 0) return 0;
+	const size_t s = bits > 62 ? bits - 62 : 0;
+	double m = (double) (h_cint_word_at(num, s) | h_cint_word_at(num, s + cint_exponent) << cint_exponent), e = (double) (bits - 1);
+	m /= (double) ((uint64_t) 1 << (bits - s - 1)); // m is in [1, 2] exactly scaled
+	if (m > 1.4142135623730951) m /= 2, ++e;
+	const double y = (m - 1) / (m + 1), y_2 = y * y;
+	double sum = 0;
+	for (int k = 21; k > 0; k -= 2) sum = sum * y_2 + 1.0 / k;
+	return e + 2 * y * sum * 1.4426950408889634; // ln(m) = 2 * atanh(y), divided by ln(2)
+}
+
+__attribute__((unused)) static inline double cint_log_approx(const cint *num) { return cint_log2_approx(num) * 0.6931471805599453; }
+
+__attribute__((unused)) static inline void cint_init_by_double(cint *num, const size_t size, const double value) { cint_init(num, size, 0), cint_reinit_by_double(num, value); }
+
 static void cint_mul(const cint *lhs, const cint *rhs, cint *res) {
 	// the multiplication (longhand method)
 	h_cint_t *l, *r, *o, *p;
+	H_CINT_BEGIN(cint_thread_sheet(), CINT_STAT_MUL, lhs);
 	cint_erase(res);
 	if (lhs->mem != lhs->end && rhs->mem != rhs->end) {
-		res->nat = lhs->nat * rhs->nat, res->end += (lhs->end - lhs->mem) + (rhs->end - rhs->mem) - 1;
+		res->nat = lhs->nat * rhs->nat;
+#ifdef __SIZEOF_INT128__
+		if (lhs->end <= lhs->mem + 2 && rhs->end <= rhs->mem + 2) {
+			// System native multiplication.
+			const h_cint_u128 x = (h_cint_u128) h_cint_to_u64(lhs) * h_cint_to_u64(rhs);
+			const uint64_t lo = (uint64_t) x & (((uint64_t) 1 << 2 * cint_exponent) - 1), hi = (uint64_t) (x >> 2 * cint_exponent);
+			*res->mem = (h_cint_t) (lo & cint_mask), *(res->mem + 1) = (h_cint_t) (lo >> cint_exponent);
+			*(res->mem + 2) = (h_cint_t) (hi & cint_mask), *(res->mem + 3) = (h_cint_t) (hi >> cint_exponent);
+			res->end += hi ? 3 + (hi >> cint_exponent != 0) : 1 + (lo >> cint_exponent != 0);
+			H_CINT_END(cint_thread_sheet(), CINT_STAT_MUL);
+			return;
+		}
+#endif
+		res->end += (lhs->end - lhs->mem) + (rhs->end - rhs->mem) - 1;
 		for (l = lhs->mem, p = res->mem; l < lhs->end; ++l)
 			for (r = rhs->mem, o = p++; r < rhs->end; *(o + 1) += (*o += *l * *r++) >> cint_exponent, *o++ &= cint_mask);
 		res->end += *res->end != 0;
 	}
+	H_CINT_END(cint_thread_sheet(), CINT_STAT_MUL);
+}
+
+static void h_cint_addmul(cint *num, const cint *lhs, const cint *rhs, const h_cint_t nat) {
+	// num += nat * |lhs * rhs| in a single pass (longhand method), where nat is 1 or -1. "num" needs the words of the
+	// product plus one, it's not an operand.
+	const size_t a = lhs->end - lhs->mem, b = rhs->end - rhs->mem, n = num->end - num->mem, len = n > a + b ? n : a + b;
+	if (a == 0 || b == 0) return;
+	h_cint_t *o = num->mem, *p, *e = o + len, x, y;
+	if (n == 0) num->nat = nat;
+	if (num->nat == nat)
+		for (const h_cint_t *l = lhs->mem, *r; l < lhs->end; ++l, ++o) {
+			for (r = rhs->mem, p = o, x = 0; r < rhs->end; ++p)
+				x += *p + *l * *r++, *p = x & cint_mask, x >>= cint_exponent;
+			for (; x; ++p) x += *p, *p = x & cint_mask, x >>= cint_exponent;
+		}
+	else {
+		// the words are subtracted, a borrow out of the top means that the sign changes.
+		int negative = 0;
+		for (const h_cint_t *l = lhs->mem, *r; l < lhs->end; ++l, ++o) {
+			for (r = rhs->mem, p = o, x = 0, y = 0; r < rhs->end; ++p, x >>= cint_exponent)
+				x += *l * *r++, y = *p - (x & cint_mask) - y, *p = y & cint_mask, y = y < 0;
+			for (; (x | y) && p < e; ++p, x >>= cint_exponent)
+				y = *p - (x & cint_mask) - y, *p = y & cint_mask, y = y < 0;
+			negative |= y != 0;
+		}
+		if (negative) {
+			// the magnitude is 2 ** (31 * len) minus the words.
+			for (p = num->mem, x = 1; p < e; ++p) x += cint_mask - *p, *p = x & cint_mask, x >>= cint_exponent;
+			num->nat = -num->nat;
+		}
+	}
+	for (num->end = e + 1; num->end > num->mem && !*(num->end - 1); --num->end);
+	if (num->end == num->mem) num->nat = 1;
 }
 
+static inline void cint_addmul(cint *num, const cint *lhs, const cint *rhs) { h_cint_addmul(num, lhs, rhs, lhs->nat * rhs->nat); }
+
+static inline void cint_submul(cint *num, const cint *lhs, const cint *rhs) { h_cint_addmul(num, lhs, rhs, -lhs->nat * rhs->nat); }
+
 static void cint_powi(cint_sheet *sheet, cint *n, const cint *exp) {
 	// read the exponent bit by bit to perform the "fast" exponentiation in place.
 	if (n->mem != n->end) {
@@ -369,10 +618,52 @@ static void h_cint_div_approx(const cint *lhs, const cint *rhs, cint *res) {
 	}
 }
 
+#ifndef CINT_DIV_SCHOOLBOOK_THRESHOLD
+#define CINT_DIV_SCHOOLBOOK_THRESHOLD 1 // the words of the quotient from which "cint_div" uses the long division.
+#endif
+
+static void h_cint_div_schoolbook(cint_sheet *sheet, const cint *lhs, const cint *rhs, cint *q, cint *r) {
+	// the long division (Knuth's algorithm D) of the magnitudes, the divisor has 2 words at least.
+	cint *u = h_cint_tmp(sheet, 0, lhs), *v = h_cint_tmp(sheet, 1, lhs);
+	const size_t n = rhs->end - rhs->mem, m = lhs->end - lhs->mem - n;
+	int s = 0;
+	while (*(rhs->end - 1) << s <= cint_mask >> 1) ++s; // the top word of the divisor gets its highest bit.
+	cint_dup(u, lhs), cint_dup(v, rhs), cint_left_shifti(u, s), cint_left_shifti(v, s);
+	h_cint_t *U = u->mem, *V = v->mem, top = V[n - 1], next = V[n - 2];
+	u->end = U + m + n + 1;
+	for (size_t j = m + 1; j--;) {
+		// the estimation of the quotient word is too large by 2 at most, it's corrected twice at most.
+		H_CINT_COUNT(sheet, CINT_STAT_DIV_STEP);
+		h_cint_t num = U[j + n] << cint_exponent | U[j + n - 1], qhat = num / top, rhat = num % top;
+		while (qhat > cint_mask || qhat * next > (rhat << cint_exponent | U[j + n - 2]))
+			if (--qhat, (rhat += top) > cint_mask) break;
+		h_cint_t mul = 0, sub = 0;
+		for (size_t i = 0; i < n; ++i, mul >>= cint_exponent) {
+			mul += qhat * V[i];
+			sub = U[i + j] - (mul & cint_mask) - sub;
+			U[i + j] = sub & cint_mask, sub = sub < 0;
+		}
+		if (sub = U[j + n] - mul - sub, sub < 0) {
+			// the divisor is added back.
+			h_cint_t add = 0;
+			for (size_t i = 0; i < n; ++i, add >>= cint_exponent)
+				add += U[i + j] + V[i], U[i + j] = add & cint_mask;
+			--qhat, sub += add;
+		}
+		U[j + n] = sub, q->mem[j] = qhat;
+	}
+	q->end = q->mem + m + 1, q->end -= !*(q->end - 1);
+	memcpy(r->mem, U, n * sizeof(h_cint_t)), r->end = r->mem + n;
+	while (r->end > r->mem && !*(r->end - 1)) --r->end;
+	cint_right_shifti(r, s), cint_erase(u), cint_erase(v);
+}
+
 static void cint_div(cint_sheet *sheet, const cint *lhs, const cint *rhs, cint *q, cint *r) {
-	// The combined division algorithm, it uses the approximation algorithm, "fast" with small inputs.
+	// The combined division algorithm, it uses the approximation algorithm, "fast" with small inputs, and the long division
+	// for the long quotients.
 	// When the function terminates, it must guarantee: lhs = rhs * q + r.
 	assert(rhs->mem != rhs->end);
+	H_CINT_BEGIN(sheet, CINT_STAT_DIV, lhs);
 	cint_erase(q);
 	const int cmp = h_cint_compare(lhs, rhs);
 	if (cmp < 0)
@@ -398,12 +689,15 @@ static void cint_div(cint_sheet *sheet, const cint *lhs, const cint *rhs, cint *
 			}
 			q->end -= !*(q->end - 1);
 			r->end += *r->mem != 0;
+		} else if ((size_t) (lhs->end - lhs->mem) >= (size_t) (rhs->end - rhs->mem) + CINT_DIV_SCHOOLBOOK_THRESHOLD) {
+			// Long division for the long quotients.
+			cint_erase(r), h_cint_div_schoolbook(sheet, lhs, rhs, q, r);
 		} else {
 			// Regular division for larger numbers.
-			cint *a = h_cint_tmp(sheet, 0, lhs), *b = h_cint_tmp(sheet, 1, lhs);
+			cint *b = h_cint_tmp(sheet, 1, lhs);
 			cint_dup(r, lhs);
 			for (; h_cint_div_approx(r, rhs, b), b->mem != b->end;)
-				cint_addi(q, b), cint_mul(b, rhs, a), h_cint_subi(r, a);
+				H_CINT_COUNT(sheet, CINT_STAT_DIV_STEP), cint_addi(q, b), cint_submul(r, b, rhs);
 			if (r->end != r->mem && r->nat != lhs->nat) // lhs = q * rhs + r
 				cint_reinit(b, q->nat), h_cint_subi(q, b), h_cint_subi(r, rhs);
 		}
@@ -412,8 +706,409 @@ static void cint_div(cint_sheet *sheet, const cint *lhs, const cint *rhs, cint *
 		q->nat = -1; // Sign of the quotient.
 	if (r->mem != r->end)
 		r->nat = lhs->nat; // Sign of the remainder.
+	H_CINT_END(sheet, CINT_STAT_DIV);
+}
+
+// the functions name that terminates by "_ui" or "_si" take a machine word operand (unsigned or signed),
+// they are single pass, without temporaries and without sheet.
+
+static inline uint64_t h_cint_mod_word(const cint *num, const uint64_t m) {
+	// remainder of |num| by a machine word, computed limb by limb.
+#ifdef __SIZEOF_INT128__
+	if (m >> 33) {
+		h_cint_u128 r = 0;
+		for (const h_cint_t *p = num->end; --p >= num->mem; r = (r << cint_exponent | (uint64_t) *p) % m);
+		return (uint64_t) r;
+	}
+#else
+	assert(m >> 33 == 0);
+#endif
+	uint64_t r = 0;
+	for (const h_cint_t *p = num->end; --p >= num->mem; r = (r << cint_exponent | (uint64_t) *p) % m);
+	return r;
+}
+
+static inline int h_cint_compare_u64(const cint *num, const uint64_t val) {
+	// compare the absolute value of a number with a machine word.
+	if (num->end > num->mem + 3 || (num->end == num->mem + 3 && *(num->mem + 2) >> (64 - 2 * cint_exponent)))
+		return 1;
+	const uint64_t x = h_cint_to_u64(num) | (uint64_t) *(num->mem + 2) << 2 * cint_exponent;
+	return (x > val) - (x < val);
+}
+
+static void h_cint_addi_u64(cint *num, uint64_t val) {
+	// add a machine word to the absolute value of a number.
+	h_cint_t *p = num->mem;
+	for (uint64_t c; val; ++p)
+		c = (val & cint_mask) + (uint64_t) *p, *p = (h_cint_t) (c & cint_mask), val = (val >> cint_exponent) + (c >> cint_exponent);
+	if (p > num->end) num->end = p;
+}
+
+static void h_cint_subi_u64(cint *num, const uint64_t val) {
+	// subtract a machine word from the absolute value of a number, the sign changes when the word is greater.
+	if (h_cint_compare_u64(num, val) < 0)
+		h_cint_write_u64(num, val - (h_cint_to_u64(num) | (uint64_t) *(num->mem + 2) << 2 * cint_exponent)), num->nat = -num->nat;
+	else {
+		h_cint_t *p = num->mem, c;
+		for (uint64_t v = val; v; ++p)
+			c = *p - (h_cint_t) (v & cint_mask), v >>= cint_exponent, c < 0 ? c += cint_base, ++v : 0, *p = c;
+		for (; num->end > num->mem && !*(num->end - 1); --num->end);
+		if (num->end == num->mem) num->nat = 1;
+	}
+}
+
+static inline void cint_addi_ui(cint *num, const uint64_t val) { num->nat > 0 ? h_cint_addi_u64(num, val) : h_cint_subi_u64(num, val); }
+
+static inline void cint_subi_ui(cint *num, const uint64_t val) { num->nat > 0 ? h_cint_subi_u64(num, val) : h_cint_addi_u64(num, val); }
+
+__attribute__((unused)) static inline void cint_addi_si(cint *num, const int64_t val) { val < 0 ? cint_subi_ui(num, 0 - (uint64_t) val) : cint_addi_ui(num, (uint64_t) val); }
+
+__attribute__((unused)) static inline void cint_subi_si(cint *num, const int64_t val) { val < 0 ? cint_addi_ui(num, 0 - (uint64_t) val) : cint_subi_ui(num, (uint64_t) val); }
+
+__attribute__((unused)) static inline void cint_add_ui(const cint *lhs, const uint64_t rhs, cint *res) { cint_dup(res, lhs), cint_addi_ui(res, rhs); }
+
+__attribute__((unused)) static inline void cint_sub_ui(const cint *lhs, const uint64_t rhs, cint *res) { cint_dup(res, lhs), cint_subi_ui(res, rhs); }
+
+__attribute__((unused)) static inline void cint_addmul_ui(cint *num, const cint *lhs, const uint64_t val) {
+	h_cint_t mem[3] = {0};
+	cint w = {mem, mem, 1, 3};
+	h_cint_reinit_u64(&w, val), h_cint_addmul(num, lhs, &w, lhs->nat);
+}
+
+__attribute__((unused)) static inline void cint_submul_ui(cint *num, const cint *lhs, const uint64_t val) {
+	h_cint_t mem[3] = {0};
+	cint w = {mem, mem, 1, 3};
+	h_cint_reinit_u64(&w, val), h_cint_addmul(num, lhs, &w, -lhs->nat);
+}
+
+static void cint_muli_ui(cint *num, const uint64_t val) {
+	// multiply a number by a machine word in place (no verification about available memory).
+	h_cint_t *p = num->mem;
+	if (val >> 32 == 0) {
+		uint64_t c = 0;
+		for (; p < num->end; ++p)
+			c += (uint64_t) *p * val, *p = (h_cint_t) (c & cint_mask), c >>= cint_exponent;
+		for (; c; c >>= cint_exponent) *p++ = (h_cint_t) (c & cint_mask);
+	} else {
+#ifdef __SIZEOF_INT128__
+		h_cint_u128 c = 0;
+		for (; p < num->end; ++p)
+			c += (h_cint_u128) *p * val, *p = (h_cint_t) c & cint_mask, c >>= cint_exponent;
+		for (; c; c >>= cint_exponent) *p++ = (h_cint_t) c & cint_mask;
+#else
+		assert(val >> 32 == 0);
+#endif
+	}
+	if (val) num->end = p;
+	else cint_erase(num);
+}
+
+__attribute__((unused)) static inline void cint_muli_si(cint *num, const int64_t val) {
+	cint_muli_ui(num, val < 0 ? 0 - (uint64_t) val : (uint64_t) val);
+	if (val < 0) cint_negate(num);
+}
+
+__attribute__((unused)) static inline void cint_mul_ui(const cint *lhs, const uint64_t rhs, cint *res) { cint_dup(res, lhs), cint_muli_ui(res, rhs); }
+
+static uint64_t cint_divi_ui(cint *num, const uint64_t val) {
+	// divide a number by a machine word in place, and return the absolute value of the remainder.
+	// like "cint_div", the quotient is truncated and the remainder has the sign of the number.
+	assert(val);
+	h_cint_t *p = num->end;
+#ifdef __SIZEOF_INT128__
+	if (val >> 33) {
+		h_cint_u128 r = 0;
+		for (; --p >= num->mem; r %= val)
+			r = r << cint_exponent | (uint64_t) *p, *p = (h_cint_t) (r / val);
+		for (; num->end > num->mem && !*(num->end - 1); --num->end);
+		if (num->end == num->mem) num->nat = 1;
+		return (uint64_t) r;
+	}
+#else
+	assert(val >> 33 == 0);
+#endif
+	uint64_t r = 0;
+	for (; --p >= num->mem; r %= val)
+		r = r << cint_exponent | (uint64_t) *p, *p = (h_cint_t) (r / val);
+	for (; num->end > num->mem && !*(num->end - 1); --num->end);
+	if (num->end == num->mem) num->nat = 1;
+	return r;
+}
+
+__attribute__((unused)) static inline uint64_t cint_div_ui(const cint *lhs, const uint64_t rhs, cint *q) { return cint_dup(q, lhs), cint_divi_ui(q, rhs); }
+
+__attribute__((unused)) static inline uint64_t cint_mod_ui(const cint *num, const uint64_t val) {
+	// the non-negative residue of a number modulo a machine word.
+	const uint64_t r = h_cint_mod_word(num, val);
+	return num->nat < 0 && r ? val - r : r;
+}
+
+static int h_cint_hensel_div(h_cint_t *R, const size_t n, const h_cint_t *D, const size_t m, const size_t qn) {
+	// the Hensel division of the n words of R by the odd divisor D of m words (Jebelean's exact division), from the
+	// lowest words: R[0, qn) is replaced by the quotient, the subtractions stop at R[n - 1]. Returns 1 if they overflow.
+	uint64_t inv = (uint64_t) *D; // the inverse of D modulo the base is correct to 3 bits, then 6, 12, 24 and 48.
+	for (int i = 0; i < 4; ++i) inv *= 2 - (uint64_t) *D * inv;
+	inv &= cint_mask;
+	int overflow = 0;
+	for (size_t i = 0; i < qn; ++i) {
+		const h_cint_t x = (h_cint_t) ((uint64_t) R[i] * inv & cint_mask);
+		h_cint_t mul = 0, sub = 0, *p = R + i;
+		for (size_t k = 0; k < m && p < R + n; ++k, ++p, mul >>= cint_exponent)
+			mul += x * D[k], sub = *p - (mul & cint_mask) - sub, *p = sub & cint_mask, sub = sub < 0;
+		for (; (mul | sub) && p < R + n; ++p, mul >>= cint_exponent)
+			sub = *p - (mul & cint_mask) - sub, *p = sub & cint_mask, sub = sub < 0;
+		overflow |= (mul | sub) != 0;
+		R[i] = x;
+	}
+	return overflow;
+}
+
+static void cint_divexact(cint_sheet *sheet, const cint *lhs, const cint *rhs, cint *q) {
+	// the quotient of a division known to be exact, only the lowest words of the subtractions are computed, it's
+	// quadratic in the words of the quotient instead of their product by the words of the divisor.
+	// "q" can be "lhs" (not "rhs"), it needs the words of "lhs" plus one, an even divisor uses the temporary 0.
+	assert(rhs->mem != rhs->end);
+	const size_t z = cint_count_zeros(rhs);
+	const h_cint_t nat = lhs->nat * rhs->nat;
+	if (z) {
+		cint *d = h_cint_tmp(sheet, 0, rhs);
+		cint_dup(d, rhs), cint_right_shifti(d, z), rhs = d;
+	}
+	if (q != lhs) cint_dup(q, lhs);
+	cint_right_shifti(q, z);
+	const size_t n = q->end - q->mem, m = rhs->end - rhs->mem;
+	if (n < m) cint_erase(q);
+	else {
+		h_cint_hensel_div(q->mem, n - m + 1, rhs->mem, m, n - m + 1);
+		memset(q->end = q->mem + n - m + 1, 0, (m - 1) * sizeof(h_cint_t));
+		for (; q->end > q->mem && !*(q->end - 1); --q->end);
+		q->nat = q->end == q->mem ? 1 : nat;
+	}
+}
+
+static int cint_is_divisible(cint_sheet *sheet, const cint *num, const cint *div) {
+	// tell whether "div" divides "num", by a single word remainder or a Hensel division without quotient, it uses the
+	// temporaries 0 and 1.
+	if (div->mem == div->end || num->mem == num->end) return num->mem == num->end;
+#ifdef __SIZEOF_INT128__
+	if (div->end <= div->mem + 2) return h_cint_mod_word(num, h_cint_to_u64(div)) == 0;
+#else
+	if (div->end == div->mem + 1) return h_cint_mod_word(num, (uint64_t) *div->mem) == 0;
+#endif
+	const size_t z = cint_count_zeros(div);
+	if (cint_count_zeros(num) < z || h_cint_compare(num, div) < 0) return 0;
+	cint *R = h_cint_tmp(sheet, 0, num), *D = h_cint_tmp(sheet, 1, div);
+	cint_dup(R, num), cint_right_shifti(R, z), cint_dup(D, div), cint_right_shifti(D, z);
+	const size_t n = R->end - R->mem, m = D->end - D->mem;
+	int res = n >= m && !h_cint_hensel_div(R->mem, n, D->mem, m, n - m + 1);
+	// the number is divisible when the subtractions leave zero, its quotient fits the n - m + 1 lowest words.
+	for (const h_cint_t *p = R->mem + n - m + 1; res && p < R->end; res = !*p++);
+	return cint_erase(R), res;
+}
+
+__attribute__((unused)) static inline int cint_compare_ui(const cint *lhs, const uint64_t rhs) { return lhs->nat < 0 ? -1 : h_cint_compare_u64(lhs, rhs); }
+
+__attribute__((unused)) static inline int cint_compare_si(const cint *lhs, const int64_t rhs) {
+	if ((lhs->nat < 0) != (rhs < 0)) return (int) lhs->nat;
+	return (int) lhs->nat * h_cint_compare_u64(lhs, rhs < 0 ? 0 - (uint64_t) rhs : (uint64_t) rhs);
+}
+
+__attribute__((unused)) static void cint_ui_pow_ui(cint *res, const uint64_t base, unsigned exp) {
+	// raise a machine word to a power, multiplying by as many factors as a word can hold.
+	cint_reinit(res, 1);
+	if (base >> 32) for (; exp--; cint_muli_ui(res, base));
+	else if (base > 1)
+		for (uint64_t w; exp; cint_muli_ui(res, w))
+			for (w = base, --exp; exp && w * base >> 32 == 0; w *= base, --exp);
+	else if (base == 0 && exp) cint_erase(res);
+}
+
+#ifdef __SIZEOF_INT128__
+
+static uint64_t h_cint_pow_mod_u64(const cint *n, const cint *exp, const uint64_t m) {
+	// the native exponentiation |n| ** exp mod m, the modulus fits a machine word.
+	uint64_t a = 1 % m, b = h_cint_mod_word(n, m);
+	for (size_t i = 0, bits = cint_count_bits(exp); i < bits; ++i, b = (uint64_t) ((h_cint_u128) b * b % m))
+		if (exp->mem[i / cint_exponent] >> i % cint_exponent & 1)
+			a = (uint64_t) ((h_cint_u128) a * b % m);
+	return a;
+}
+
+__attribute__((unused)) static inline uint64_t cint_pow_mod_ui(const cint *n, const cint *exp, const uint64_t mod) {
+	// the non-negative residue of n ** exp modulo a machine word.
+	assert(mod);
+	const uint64_t r = h_cint_pow_mod_u64(n, exp, mod);
+	return n->nat < 0 && *exp->mem & 1 && r ? mod - r : r;
+}
+
+#endif
+
+// The bitwise functions see the numbers in two's complement with an infinite sign extension (like GMP), so -1 has
+// all its bits set. The negative operands are complemented word by word on the fly, from the lowest words.
+
+static inline void h_cint_bitwise(const cint *lhs, const cint *rhs, cint *res, const int op) {
+	// res = lhs op rhs, where op is '&', '|' or '^', "res" can be an operand and needs their words plus one.
+	const size_t a = lhs->end - lhs->mem, b = rhs->end - rhs->mem, n = 1 + (a > b ? a : b);
+	const int x = lhs->nat < 0, y = rhs->nat < 0, neg = op == '&' ? x & y : op == '|' ? x | y : x ^ y;
+	h_cint_t c_l = x, c_r = y, c_res = neg, l, r, w, *o = res->mem;
+	for (size_t i = 0; i < n; ++i) {
+		l = i < a ? lhs->mem[i] : 0, r = i < b ? rhs->mem[i] : 0;
+		if (x) l = (~l & cint_mask) + c_l, c_l = l >> cint_exponent, l &= cint_mask;
+		if (y) r = (~r & cint_mask) + c_r, c_r = r >> cint_exponent, r &= cint_mask;
+		w = op == '&' ? l & r : op == '|' ? l | r : l ^ r;
+		if (neg) w = (~w & cint_mask) + c_res, c_res = w >> cint_exponent, w &= cint_mask;
+		o[i] = w;
+	}
+	if (res->end > o + n) memset(o + n, 0, (size_t) (res->end - o - n) * sizeof(h_cint_t));
+	for (res->end = o + n; res->end > o && !*(res->end - 1); --res->end);
+	res->nat = res->end == o ? 1 : 1 - 2 * neg;
+}
+
+__attribute__((unused)) static inline void cint_and(const cint *lhs, const cint *rhs, cint *res) { h_cint_bitwise(lhs, rhs, res, '&'); }
+
+__attribute__((unused)) static inline void cint_or(const cint *lhs, const cint *rhs, cint *res) { h_cint_bitwise(lhs, rhs, res, '|'); }
+
+__attribute__((unused)) static inline void cint_xor(const cint *lhs, const cint *rhs, cint *res) { h_cint_bitwise(lhs, rhs, res, '^'); }
+
+__attribute__((unused)) static inline void cint_not(const cint *num, cint *res) { cint_dup(res, num), cint_negate(res), cint_subi_ui(res, 1); } // -num - 1
+
+static h_cint_t h_cint_complement_carry(const cint *num, const size_t w) {
+	// the carry entering the word "w" of the complement of a negative number, 1 when the lower words are zero.
+	const h_cint_t *p = num->mem, *e = w < (size_t) (num->end - num->mem) ? num->mem + w : num->end;
+	for (; p < e && !*p; ++p);
+	return p == e;
+}
+
+__attribute__((unused)) static int cint_test_bit(const cint *num, const size_t bit) {
+	const size_t w = bit / cint_exponent;
+	h_cint_t word = w < (size_t) (num->end - num->mem) ? num->mem[w] : 0;
+	if (num->nat < 0) word = (~word & cint_mask) + h_cint_complement_carry(num, w);
+	return (int) (word >> bit % cint_exponent & 1);
+}
+
+__attribute__((unused)) static void cint_set_bit(cint *num, const size_t bit, const int value) {
+	// set the bit to the value (0 or 1), "num" needs the words of the bit plus one.
+	if (cint_test_bit(num, bit) == !!value) return;
+	// the magnitude gains 2^bit when a positive number gets the bit or a negative one loses it, else it loses 2^bit.
+	h_cint_t *p = num->mem + bit / cint_exponent, c = (h_cint_t) 1 << bit % cint_exponent;
+	if ((num->nat > 0) == !!value) {
+		for (; c; ++p) c += *p, *p = c & cint_mask, c >>= cint_exponent;
+		if (p > num->end) num->end = p;
+	} else {
+		for (; c; ++p) c = *p - c, *p = c & cint_mask, c = c < 0;
+		for (; num->end > num->mem && !*(num->end - 1); --num->end);
+		if (num->end == num->mem) num->nat = 1;
+	}
+}
+
+__attribute__((unused)) static size_t cint_popcount(const cint *num) {
+	// the set bits of the absolute value.
+	size_t res = 0;
+	for (const h_cint_t *p = num->mem; p < num->end; res += h_cint_word_ones(*p++));
+	return res;
+}
+
+__attribute__((unused)) static size_t cint_scan1(const cint *num, const size_t start) {
+	// the index of the first set bit from "start", or SIZE_MAX when a positive number has none.
+	const size_t n = num->end - num->mem;
+	size_t w = start / cint_exponent;
+	h_cint_t c = num->nat < 0 ? h_cint_complement_carry(num, w) : 0, word;
+	for (h_cint_t low = cint_mask << start % cint_exponent & cint_mask; w < n || num->nat < 0; ++w, low = cint_mask) {
+		word = w < n ? num->mem[w] : 0;
+		if (num->nat < 0) word = (~word & cint_mask) + c, c = word >> cint_exponent, word &= cint_mask;
+		if (word & low) return w * cint_exponent + h_cint_word_zeros(word & low);
+	}
+	return SIZE_MAX;
+}
+
+// The accumulator adds numbers and products without propagating their carries. The 31-bit words are stored on 64 bits,
+// so a word receives about 2^32 additions of 31-bit values before it could overflow, the carries are propagated once
+// when this room is exhausted or when the sum is read. It suits the dot products, summing thousands of products.
+
+typedef struct {
+	cint num; // its words may exceed 31 bits or be negative until the sum is normalized, the sum is nat * words.
+	uint64_t pending; // the additions received by a word since the last normalization (at most)
+	uint64_t room; // the additions a word receives before a normalization
+} cint_accumulator;
+
+__attribute__((unused)) static cint_accumulator *cint_new_accumulator(const size_t bits) {
+	// the accumulator holds sums of "bits" bits.
+	cint_accumulator *acc = (cint_accumulator *) calloc(1, sizeof(cint_accumulator));
+	assert(acc);
+	cint_init(&acc->num, bits + 2 * cint_exponent, 0);
+	acc->room = ((uint64_t) 1 << 32) - 2;
+	return acc;
+}
+
+__attribute__((unused)) static void cint_clear_accumulator(cint_accumulator *acc) {
+	free(acc->num.mem);
+	free(acc);
+}
+
+static void h_cint_acc_normalize(cint_accumulator *acc) {
+	// propagate the carries, the words become 31-bit again.
+	cint *num = &acc->num;
+	for (h_cint_t carry = 0, *p;;) {
+		for (p = num->mem; p < num->end; ++p)
+			carry += *p, *p = carry & cint_mask, carry = (carry - *p) / cint_base;
+		for (; carry > 0; carry >>= cint_exponent)
+			assert(num->end < num->mem + num->size), *num->end++ = carry & cint_mask;
+		if (carry == 0) break;
+		// the words are negative, the sum is negated then normalized again.
+		assert(num->end < num->mem + num->size);
+		for (p = num->mem; p < num->end; ++p) *p = -*p;
+		*num->end++ = -carry, carry = 0, num->nat = -num->nat;
+	}
+	while (num->end > num->mem && *(num->end - 1) == 0) --num->end;
+	if (num->end == num->mem) num->nat = 1;
+	acc->pending = 1;
+}
+
+static inline void h_cint_acc_reserve(cint_accumulator *acc, const uint64_t additions, const size_t words) {
+	// ensure the room for the next additions, over the given words.
+	if (acc->pending + additions > acc->room) h_cint_acc_normalize(acc);
+	acc->pending += additions;
+	assert(words < acc->num.size);
+	if (acc->num.end < acc->num.mem + words) acc->num.end = acc->num.mem + words;
+}
+
+static void h_cint_acc_add(cint_accumulator *acc, const cint *num, const h_cint_t sign) {
+	h_cint_acc_reserve(acc, 1, num->end - num->mem);
+	const h_cint_t s = sign * num->nat * acc->num.nat;
+	for (h_cint_t *l = num->mem, *o = acc->num.mem; l < num->end; *o++ += s * *l++);
+}
+
+static void h_cint_acc_addmul(cint_accumulator *acc, const cint *lhs, const cint *rhs, const h_cint_t sign) {
+	// the longhand multiplication, the halves of the partial products are added without carry.
+	const size_t a = lhs->end - lhs->mem, b = rhs->end - rhs->mem;
+	if (a == 0 || b == 0) return;
+	h_cint_acc_reserve(acc, 2 * (a < b ? a : b), a + b);
+	const h_cint_t s = sign * lhs->nat * rhs->nat * acc->num.nat;
+	for (h_cint_t *l = lhs->mem, *p = acc->num.mem, *r, *o, high; l < lhs->end; ++l, ++p) {
+		for (r = rhs->mem, o = p, high = 0; r < rhs->end; ++o) {
+			const h_cint_t x = *l * *r++;
+			*o += s * ((x & cint_mask) + high), high = x >> cint_exponent;
+		}
+		*o += s * high;
+	}
+}
+
+__attribute__((unused)) static inline void cint_acc_add(cint_accumulator *acc, const cint *num) { h_cint_acc_add(acc, num, 1); }
+
+__attribute__((unused)) static inline void cint_acc_sub(cint_accumulator *acc, const cint *num) { h_cint_acc_add(acc, num, -1); }
+
+__attribute__((unused)) static inline void cint_acc_addmul(cint_accumulator *acc, const cint *lhs, const cint *rhs) { h_cint_acc_addmul(acc, lhs, rhs, 1); }
+
+__attribute__((unused)) static inline void cint_acc_submul(cint_accumulator *acc, const cint *lhs, const cint *rhs) { h_cint_acc_addmul(acc, lhs, rhs, -1); }
+
+__attribute__((unused)) static void cint_acc_get(cint_accumulator *acc, cint *res) {
+	// read the sum into "res", which must be large enough.
+	h_cint_acc_normalize(acc);
+	cint_dup(res, &acc->num);
 }
 
+__attribute__((unused)) static inline void cint_acc_reset(cint_accumulator *acc) { cint_erase(&acc->num), acc->pending = 0; }
+
 static inline size_t cint_approx_bits_from_digits(const size_t digits, const int base) {
 	// approximate the number of bits for a given number of digits
 	static const unsigned char logs[] = {252, 200, 172, 154, 142, 133, 126, 120, 115, 111, 108, 105, 102, 100, 97, 95, 94, 92, 91, 89, 88, 87, 86, 85, 84, 83, 82, 81, 80, 80, 79, 78, 77, 77, 76, 76, 75, 75, 74, 74, 73, 73, 72, 72, 72, 71, 71, 70, 70, 70, 69, 69, 69, 68, 68, 68, 67, 67, 67, 67};
@@ -447,7 +1142,7 @@ static char *cint_to_string_buffer(const cint *num, char *buf, const int base) {
 }
 
 __attribute__((unused)) static inline char *cint_to_string(const cint *num, const int base) {
-	char *mem = malloc(cint_approx_digits_from_bits(cint_count_bits(num), base));
+	char *mem = (char *) malloc(cint_approx_digits_from_bits(cint_count_bits(num), base));
 	assert(mem); // Allocate a string to represent the number in the given base.
 	return cint_to_string_buffer(num, mem, base);
 }
@@ -459,15 +1154,11 @@ __attribute__((unused)) static char *cint_to_string_buffer_alt(cint_sheet *sheet
 	if (num->mem == num->end)
 		*buf = '0', *(buf + 1) = 0;
 	else {
-		cint *A = h_cint_tmp(sheet, 3, num), *B = h_cint_tmp(sheet, 4, num), *C = h_cint_tmp(sheet, 5, num), *D = h_cint_tmp(sheet, 6, num), *TMP;
+		cint *A = h_cint_tmp(sheet, 3, num);
 		cint_dup(A, num);
-		cint_reinit(B, base);
 		char *end = buf;
-		while (A->mem != A->end) {
-			cint_div(sheet, A, B, C, D);
-			*end++ = cint_alpha[*D->mem];
-			TMP = A, A = C, C = TMP;
-		}
+		while (A->mem != A->end)
+			*end++ = cint_alpha[cint_divi_ui(A, base)];
 		if (num->nat < 0)
 			*end++ = '-';
 		*end = 0;
@@ -477,74 +1168,718 @@ __attribute__((unused)) static char *cint_to_string_buffer_alt(cint_sheet *sheet
 }
 
 __attribute__((unused)) static inline char *cint_to_string_alt(cint_sheet *sheet, const cint *num, const int base) {
-	char *mem = malloc(cint_approx_digits_from_bits(cint_count_bits(num), base));
+	char *mem = (char *) malloc(cint_approx_digits_from_bits(cint_count_bits(num), base));
 	assert(mem); // Allocate a string to represent the number in the given base.
 	return cint_to_string_buffer_alt(sheet, num, mem, base);
 }
 
-void cint_factorial(cint_sheet *sheet, unsigned factorial_n, cint *res) {
-	cint *A = h_cint_tmp(sheet, 0, res), *B = h_cint_tmp(sheet, 1, res), *TMP;
-	cint_reinit(B, 1);
-	cint_reinit(res, 1);
-	for (unsigned i = 1; i < factorial_n;) {
-		cint_reinit(A, ++i);
-		cint_mul(B, A, res);
-		TMP = B, B = res, res = TMP;
-	}
-	if (factorial_n & 1)
-		cint_dup(res, B);
-}
+// The streaming conversion writes the digits, most significant first, to a callback by chunks of CINT_STREAM_CHUNK
+// characters. The number is cut by the powers base^(k * 2^j) (a divide and conquer tree), so the memory stays linear
+// in the size of the number, and the output starts after the first divisions.
 
-__attribute__((unused)) static inline void cint_mul_mod(cint_sheet *sheet, const cint *lhs, const cint *rhs, const cint *mod, cint *res) {
-	cint *a = h_cint_tmp(sheet, 2, res), *b = h_cint_tmp(sheet, 3, res);
-	cint_mul(lhs, rhs, a);
-	cint_div(sheet, a, mod, b, res);
+#ifndef CINT_STREAM_CHUNK
+#define CINT_STREAM_CHUNK 4096
+#endif
+
+enum { H_CINT_STREAM_LEAF = 8 }; // the words of the leaves, converted by divisions by a machine word.
+
+typedef struct {
+	cint_sheet *sheet;
+	cint *powers, *q, *r, leaf;
+	uint64_t word; // base ** digits
+	size_t digits; // digits per word
+	int base;
+	void (*emit)(const char *chunk, size_t len, void *data);
+	void *data;
+	size_t len;
+	char buf[CINT_STREAM_CHUNK];
+} h_cint_stream;
+
+static void h_cint_stream_put(h_cint_stream *s, const char *str, size_t len) {
+	for (size_t n; len; str += n, len -= n) {
+		n = CINT_STREAM_CHUNK - s->len < len ? CINT_STREAM_CHUNK - s->len : len;
+		memcpy(s->buf + s->len, str, n), s->len += n;
+		if (s->len == CINT_STREAM_CHUNK)
+			s->emit(s->buf, s->len, s->data), s->len = 0;
+	}
 }
 
-static inline void cint_mul_modi(cint_sheet *sheet, cint *lhs, const cint *rhs, const cint *mod) {
-	cint *a = h_cint_tmp(sheet, 2, lhs), *b = h_cint_tmp(sheet, 3, lhs);
-	cint_mul(lhs, rhs, a);
-	cint_div(sheet, a, mod, b, lhs);
+static void h_cint_stream_write(h_cint_stream *s, const cint *num, const int level, const int pad) {
+	// write the absolute value of "num" (lower than powers[level + 1]), zero-padded to the digits of powers[level + 1] when "pad" is set.
+	if (level < 0) {
+		char digits[H_CINT_STREAM_LEAF * 32], *end = digits + H_CINT_STREAM_LEAF * s->digits, *p = end;
+		cint_dup(&s->leaf, num), s->leaf.nat = 1;
+		for (int i = 0; i < H_CINT_STREAM_LEAF; ++i)
+			for (uint64_t r = cint_divi_ui(&s->leaf, s->word), j = 0; j < s->digits; ++j)
+				*--p = cint_alpha[r % s->base], r /= s->base;
+		if (!pad) while (p < end && *p == '0') ++p;
+		h_cint_stream_put(s, p, end - p);
+	} else {
+		cint *q = s->q + level, *r = s->r + level;
+		cint_div(s->sheet, num, s->powers + level, q, r);
+		q->nat = r->nat = 1;
+		const int leading = pad || q->mem != q->end;
+		if (leading) h_cint_stream_write(s, q, level - 1, pad);
+		h_cint_stream_write(s, r, level - 1, leading);
+	}
 }
 
-static inline void cint_pow_modi(cint_sheet *sheet, cint *n, const cint *exp, const cint *mod) {
-	// same as "power" algorithm, difference is that it take the modulo as soon as possible.
-	if (n->mem != n->end) {
-		size_t bits = cint_count_bits(exp);
-		switch (bits) {
-			case 0 :
-				cint_reinit(n, n->mem != n->end);
-				break;
-			case 1 :
-				break;
-			default:;
-				cint *a = h_cint_tmp(sheet, 2, n);
-				cint *b = h_cint_tmp(sheet, 3, n);
-				cint *c = h_cint_tmp(sheet, 4, n);
-				cint_erase(a), *a->end++ = 1;
-				h_cint_t mask = 1;
-				for (const h_cint_t *ptr = exp->mem;;) {
-					if (*ptr & mask)
-						cint_mul(a, n, b), cint_div(sheet, b, mod, c, a);
-					if (--bits) {
-						cint_mul(n, n, b), cint_div(sheet, b, mod, c, n);
-						mask <<= 1;
-						if (mask == cint_base) mask = 1, ++ptr;
-					} else break;
-				}
-				cint_dup(n, a);
+__attribute__((unused)) static void cint_write_stream(cint_sheet *sheet, const cint *num, const int base, void (*emit)(const char *chunk, size_t len, void *data), void *data) {
+	// write the number in the given base (from 2 to 62) to the callback, by chunks, without the final null character.
+	h_cint_stream s;
+	s.sheet = sheet, s.base = base, s.emit = emit, s.data = data, s.len = 0;
+	for (s.word = base, s.digits = 1; s.word * base >> 32 == 0; s.word *= base, ++s.digits);
+	if (num->nat < 0 && num->mem != num->end) h_cint_stream_put(&s, "-", 1);
+	if (num->mem == num->end) h_cint_stream_put(&s, "0", 1);
+	else {
+		// the powers lower than or equal to the number, each one is the square of the previous one. the square of the
+		// last one isn't computed when its bit count (2 * bits - 1 at least) shows that it exceeds the number.
+		const size_t max_levels = 8 * sizeof(size_t);
+		s.powers = (cint *) calloc(3 * max_levels, sizeof(cint));
+		assert(s.powers);
+		s.q = s.powers + max_levels, s.r = s.q + max_levels;
+		int levels = 0;
+		cint_init(s.powers, H_CINT_STREAM_LEAF * cint_exponent * 2 + 64, 1);
+		for (int i = 0; i < H_CINT_STREAM_LEAF; ++i) cint_muli_ui(s.powers, s.word);
+		cint_init(&s.leaf, cint_count_bits(s.powers) + 64, 0);
+		for (const size_t num_bits = cint_count_bits(num); h_cint_compare(s.powers + levels, num) <= 0;) {
+			const size_t bits = cint_count_bits(s.powers + levels);
+			cint_init(s.q + levels, 2 * bits + 128, 0), cint_init(s.r + levels, 2 * bits + 128, 0);
+			if (++levels, 2 * bits - 1 > num_bits) break;
+			cint_init(s.powers + levels, 2 * bits + 128, 0);
+			cint_mul(s.powers + levels - 1, s.powers + levels - 1, s.powers + levels);
 		}
+		h_cint_stream_write(&s, num, levels - 1, 0);
+		for (int i = 0; i <= levels; ++i)
+			free(s.powers[i].mem), free(s.q[i].mem), free(s.r[i].mem);
+		free(s.leaf.mem), free(s.powers);
 	}
+	if (s.len) emit(s.buf, s.len, data);
 }
 
-__attribute__((unused)) static void cint_pow_mod(cint_sheet *sheet, const cint *n, const cint *exp, const cint *mod, cint *res) {
+static void h_cint_stream_file(const char *chunk, const size_t len, void *data) { fwrite(chunk, 1, len, (FILE *) data); }
+
+__attribute__((unused)) static inline void cint_write_file(cint_sheet *sheet, const cint *num, const int base, FILE *out) { cint_write_stream(sheet, num, base, h_cint_stream_file, out); }
+
+static void h_cint_range_product(cint *res, uint64_t from, const uint64_t to) {
+	// the product of the integers from "from" to "to", multiplying in place by as many consecutive factors as a machine word can hold.
+	cint_reinit(res, 1);
+	for (uint64_t w; from <= to; cint_muli_ui(res, w))
+		for (w = from++; from <= to && w * from >> 32 == 0; w *= from++);
+}
+
+void cint_factorial(cint_sheet *sheet, unsigned factorial_n, cint *res) {
+	// the sheet isn't needed anymore, the parameter is kept for the compatibility of the API.
+	(void) sheet;
+	h_cint_range_product(res, 2, factorial_n);
+}
+
+#ifdef CINT_THREADS
+
+// The parallel mode is opt-in (compile with "-DCINT_THREADS -pthread"). A pool of threads shares the work of the
+// large multiplications, divisions and factorials, every thread has its own computation sheet and deque of tasks,
+// and the idle threads steal tasks from the others. A pool is used by one calling thread at a time, which helps.
+
+#ifndef CINT_PARALLEL_MUL_THRESHOLD
+#define CINT_PARALLEL_MUL_THRESHOLD 262144 // product of the lengths (in words) below which the serial multiplication is used.
+#endif
+
+#ifndef CINT_PARALLEL_FACTORIAL_THRESHOLD
+#define CINT_PARALLEL_FACTORIAL_THRESHOLD 8192 // factorials below it are computed serially.
+#endif
+
+typedef struct {
+	void (*func)(cint_sheet *sheet, void *arg);
+	void *arg;
+	size_t *pending;
+} h_cint_task;
+
+typedef struct {
+	pthread_mutex_t lock;
+	h_cint_task *tasks;
+	size_t head, tail, size; // ring buffer, the owner works at the tail and the thieves steal at the head.
+} h_cint_deque;
+
+typedef struct cint_pool cint_pool;
+
+typedef struct {
+	cint_pool *pool;
+	unsigned id;
+} h_cint_worker;
+
+struct cint_pool {
+	unsigned n_threads, next;
+	pthread_t *threads;
+	h_cint_worker *workers;
+	h_cint_deque *deques; // one per thread, the last one is the caller's.
+	cint_sheet **sheets; // one per thread, the last one is the caller's.
+	pthread_mutex_t lock;
+	pthread_cond_t wake, done;
+	size_t queued;
+	int stop;
+};
+
+static void h_cint_deque_push(h_cint_deque *d, const h_cint_task task) {
+	pthread_mutex_lock(&d->lock);
+	if (d->tail - d->head == d->size) {
+		h_cint_task *tasks = (h_cint_task *) malloc((d->size << 1) * sizeof(h_cint_task));
+		assert(tasks);
+		for (size_t i = d->head; i < d->tail; ++i)
+			tasks[i - d->head] = d->tasks[i % d->size];
+		free(d->tasks);
+		d->tasks = tasks, d->tail -= d->head, d->head = 0, d->size <<= 1;
+	}
+	d->tasks[d->tail++ % d->size] = task;
+	pthread_mutex_unlock(&d->lock);
+}
+
+static int h_cint_deque_pop(h_cint_deque *d, h_cint_task *task, const int steal) {
+	pthread_mutex_lock(&d->lock);
+	const int res = d->head != d->tail;
+	if (res) *task = steal ? d->tasks[d->head++ % d->size] : d->tasks[--d->tail % d->size];
+	pthread_mutex_unlock(&d->lock);
+	return res;
+}
+
+static int h_cint_pool_take(cint_pool *pool, const unsigned self, h_cint_task *task) {
+	// take a task from the own deque first, otherwise steal one from another deque.
+	int res = h_cint_deque_pop(pool->deques + self, task, 0);
+	for (unsigned i = 1; !res && i <= pool->n_threads; ++i)
+		res = h_cint_deque_pop(pool->deques + (self + i) % (pool->n_threads + 1), task, 1);
+	if (res) {
+		pthread_mutex_lock(&pool->lock);
+		--pool->queued;
+		pthread_mutex_unlock(&pool->lock);
+	}
+	return res;
+}
+
+static void h_cint_pool_execute(cint_pool *pool, const unsigned self, const h_cint_task *task) {
+	task->func(pool->sheets[self], task->arg);
+	pthread_mutex_lock(&pool->lock);
+	if (--*task->pending == 0) pthread_cond_broadcast(&pool->done);
+	pthread_mutex_unlock(&pool->lock);
+}
+
+static void *h_cint_pool_worker(void *arg) {
+	const h_cint_worker *worker = (const h_cint_worker *) arg;
+	cint_pool *pool = worker->pool;
+	for (h_cint_task task;;)
+		if (h_cint_pool_take(pool, worker->id, &task))
+			h_cint_pool_execute(pool, worker->id, &task);
+		else {
+			pthread_mutex_lock(&pool->lock);
+			for (; !pool->queued && !pool->stop; pthread_cond_wait(&pool->wake, &pool->lock));
+			const int stop = pool->stop && !pool->queued;
+			pthread_mutex_unlock(&pool->lock);
+			if (stop) break;
+		}
+	return 0;
+}
+
+static void h_cint_pool_run(cint_pool *pool, void (*func)(cint_sheet *, void *), void *args, const size_t arg_size, const size_t n) {
+	// run "func" over the "n" arguments in parallel, the caller helps until they are all done.
+	size_t pending = n;
+	pthread_mutex_lock(&pool->lock);
+	pool->queued += n;
+	pthread_mutex_unlock(&pool->lock);
+	for (size_t i = 0; i < n; ++i)
+		h_cint_deque_push(pool->deques + pool->next++ % pool->n_threads, (h_cint_task) {func, (char *) args + i * arg_size, &pending});
+	pthread_mutex_lock(&pool->lock);
+	pthread_cond_broadcast(&pool->wake);
+	pthread_mutex_unlock(&pool->lock);
+	for (h_cint_task task;;)
+		if (h_cint_pool_take(pool, pool->n_threads, &task))
+			h_cint_pool_execute(pool, pool->n_threads, &task);
+		else {
+			pthread_mutex_lock(&pool->lock);
+			for (; pending && !pool->queued; pthread_cond_wait(&pool->done, &pool->lock));
+			const int finished = !pending;
+			pthread_mutex_unlock(&pool->lock);
+			if (finished) break;
+		}
+}
+
+__attribute__((unused)) static cint_pool *cint_new_pool(const unsigned n_threads, const size_t bits) {
+	// a pool of "n_threads" threads (at least 1), their computation sheets are created for numbers of "bits" bits.
+	assert(n_threads);
+	cint_pool *pool = (cint_pool *) calloc(1, sizeof(cint_pool));
+	assert(pool);
+	pool->n_threads = n_threads;
+	pool->threads = (pthread_t *) calloc(n_threads, sizeof(pthread_t));
+	pool->workers = (h_cint_worker *) calloc(n_threads, sizeof(h_cint_worker));
+	pool->deques = (h_cint_deque *) calloc(n_threads + 1, sizeof(h_cint_deque));
+	pool->sheets = (cint_sheet **) calloc(n_threads + 1, sizeof(cint_sheet *));
+	assert(pool->threads && pool->workers && pool->deques && pool->sheets);
+	pthread_mutex_init(&pool->lock, 0);
+	pthread_cond_init(&pool->wake, 0);
+	pthread_cond_init(&pool->done, 0);
+	for (unsigned i = 0; i <= n_threads; ++i) {
+		pool->sheets[i] = cint_new_sheet(bits);
+		pthread_mutex_init(&pool->deques[i].lock, 0);
+		pool->deques[i].tasks = (h_cint_task *) malloc(16 * sizeof(h_cint_task));
+		assert(pool->deques[i].tasks);
+		pool->deques[i].size = 16;
+	}
+	for (unsigned i = 0; i < n_threads; ++i) {
+		pool->workers[i] = (h_cint_worker) {pool, i};
+		const int err = pthread_create(pool->threads + i, 0, h_cint_pool_worker, pool->workers + i);
+		assert(err == 0), (void) err;
+	}
+	return pool;
+}
+
+__attribute__((unused)) static void cint_clear_pool(cint_pool *pool) {
+	pthread_mutex_lock(&pool->lock);
+	pool->stop = 1;
+	pthread_cond_broadcast(&pool->wake);
+	pthread_mutex_unlock(&pool->lock);
+	for (unsigned i = 0; i < pool->n_threads; ++i)
+		pthread_join(pool->threads[i], 0);
+	for (unsigned i = 0; i <= pool->n_threads; ++i) {
+		cint_clear_sheet(pool->sheets[i]);
+		pthread_mutex_destroy(&pool->deques[i].lock);
+		free(pool->deques[i].tasks);
+	}
+	pthread_mutex_destroy(&pool->lock);
+	pthread_cond_destroy(&pool->wake);
+	pthread_cond_destroy(&pool->done);
+	free(pool->threads), free(pool->workers), free(pool->deques), free(pool->sheets), free(pool);
+}
+
+typedef struct {
+	cint lhs, res;
+	const cint *rhs;
+} h_cint_mul_block;
+
+static void h_cint_mul_task(cint_sheet *sheet, void *arg) {
+	h_cint_mul_block *block = (h_cint_mul_block *) arg;
+	(void) sheet;
+	cint_mul(&block->lhs, block->rhs, &block->res);
+}
+
+static void cint_mul_parallel(cint_pool *pool, const cint *lhs, const cint *rhs, cint *res) {
+	// the multiplication, the longest operand is cut into blocks whose products by the other are computed in parallel.
+	if (lhs->end - lhs->mem < rhs->end - rhs->mem) {
+		const cint *tmp = lhs;
+		lhs = rhs, rhs = tmp;
+	}
+	const size_t a = lhs->end - lhs->mem, b = rhs->end - rhs->mem;
+	if (a * b < CINT_PARALLEL_MUL_THRESHOLD)
+		cint_mul(lhs, rhs, res);
+	else {
+		const size_t parts = 2 * (pool->n_threads + 1) < a ? 2 * (pool->n_threads + 1) : a;
+		const size_t width = (a + parts - 1) / parts, n = (a + width - 1) / width; // every block starts inside the operand
+		h_cint_mul_block *blocks = (h_cint_mul_block *) calloc(n, sizeof(h_cint_mul_block));
+		assert(blocks);
+		for (size_t i = 0; i < n; ++i) {
+			h_cint_t *from = lhs->mem + i * width, *to = (size_t) (lhs->end - from) > width ? from + width : lhs->end;
+			for (; to > from && !*(to - 1); --to); // a block has no leading zero
+			blocks[i].lhs = (cint) {from, to, 1, (size_t) (to - from)};
+			blocks[i].rhs = rhs;
+			cint_init(&blocks[i].res, (width + b + 1) * cint_exponent, 0);
+		}
+		h_cint_pool_run(pool, h_cint_mul_task, blocks, sizeof(*blocks), n);
+		cint_erase(res);
+		for (size_t i = 0; i < n; ++i) {
+			h_cint_t *o = res->mem + i * width;
+			for (const h_cint_t *p = blocks[i].res.mem; p < blocks[i].res.end;)
+				*o += *p++, *(o + 1) += *o >> cint_exponent, *o++ &= cint_mask;
+			for (; *o & cint_base; *(o + 1) += *o >> cint_exponent, *o++ &= cint_mask);
+			free(blocks[i].res.mem);
+		}
+		free(blocks);
+		for (res->end = res->mem + a + b; !*(res->end - 1); --res->end);
+		res->nat = lhs->nat * rhs->nat;
+	}
+}
+
+__attribute__((unused)) static void cint_div_parallel(cint_pool *pool, const cint *lhs, const cint *rhs, cint *q, cint *r) {
+	// the division, it's a long division whose digits are blocks of k words : a block of the quotient is estimated by a
+	// short serial division of the leading words, then its product by the divisor is computed in parallel and subtracted.
+	cint_sheet *sheet = pool->sheets[pool->n_threads];
+	const size_t n = rhs->end - rhs->mem;
+	if (n < 3 || h_cint_compare(lhs, rhs) <= 0 || (size_t) (lhs->end - lhs->mem) * n < CINT_PARALLEL_MUL_THRESHOLD)
+		cint_div(sheet, lhs, rhs, q, r);
+	else {
+		// the serial part costs k * k, the parallel part costs k * n / threads, they are balanced.
+		const size_t k = n / (pool->n_threads + 1) < n - 2 ? n / (pool->n_threads + 1) : n - 2, t = k + 2;
+		cint *top = h_cint_tmp(sheet, 2, lhs), *block = h_cint_tmp(sheet, 3, lhs), *rest = h_cint_tmp(sheet, 4, lhs), *prod = h_cint_tmp(sheet, 5, lhs);
+		const cint lead = {rhs->mem + n - t, rhs->end, 1, t}; // the t leading words of the divisor.
+		cint_dup(top, &lead), h_cint_addi_u64(top, 1); // rounded up, the estimations never exceed the blocks.
+		cint_erase(q), cint_dup(r, lhs), r->nat = 1;
+		while (h_cint_compare(r, rhs) >= 0) {
+			const size_t w = r->end - r->mem, s = w > n + k ? w - n - k : 0; // the block is at the word s of the quotient.
+			const cint num = {r->mem + s + n - t, r->end, 1, w - s - n + t};
+			cint rem = {r->mem + s, r->end, 1, w - s}, sum = {q->mem + s, q->end > q->mem + s ? q->end : q->mem + s, 1, q->size - s};
+			cint_div(sheet, &num, top, block, rest);
+			block->nat = 1, cint_mul_parallel(pool, block, rhs, prod), h_cint_subi(&rem, prod);
+			for (; h_cint_compare(&rem, rhs) >= 0; h_cint_addi_u64(block, 1))
+				h_cint_subi(&rem, rhs); // the estimation is too small by 3 at most.
+			h_cint_addi(&sum, block);
+			for (r->end = rem.end; r->end > r->mem && !*(r->end - 1); --r->end);
+			if (q->end < sum.end) q->end = sum.end;
+		}
+		cint_erase(top), cint_erase(block), cint_erase(rest), cint_erase(prod);
+		if (lhs->nat != rhs->nat && q->mem != q->end)
+			q->nat = -1; // Sign of the quotient.
+		if (r->mem != r->end)
+			r->nat = lhs->nat; // Sign of the remainder.
+	}
+}
+
+typedef struct {
+	cint *lhs, *rhs;
+	uint64_t from, to;
+} h_cint_product_node;
+
+static void h_cint_range_task(cint_sheet *sheet, void *arg) {
+	h_cint_product_node *node = (h_cint_product_node *) arg;
+	(void) sheet;
+	h_cint_range_product(node->lhs, node->from, node->to);
+}
+
+static void h_cint_product_task(cint_sheet *sheet, void *arg) {
+	// multiply two nodes of the product tree, the result replaces the left one.
+	h_cint_product_node *node = (h_cint_product_node *) arg;
+	cint *tmp = h_cint_tmp(sheet, 0, node->lhs->end - node->lhs->mem > node->rhs->end - node->rhs->mem ? node->lhs : node->rhs);
+	cint_mul(node->lhs, node->rhs, tmp);
+	cint_rescale(node->lhs, cint_count_bits(tmp));
+	cint_dup(node->lhs, tmp);
+}
+
+__attribute__((unused)) static void cint_factorial_parallel(cint_pool *pool, const unsigned factorial_n, cint *res) {
+	// the factorial, its ranges of factors then the levels of its product tree are multiplied in parallel.
+	if (factorial_n < CINT_PARALLEL_FACTORIAL_THRESHOLD)
+		cint_factorial(pool->sheets[pool->n_threads], factorial_n, res);
+	else {
+		size_t n = 4 * (pool->n_threads + 1), bits = 0;
+		for (unsigned x = factorial_n; x; x >>= 1, ++bits);
+		cint *parts = (cint *) calloc(n, sizeof(cint));
+		h_cint_product_node *nodes = (h_cint_product_node *) calloc(n, sizeof(h_cint_product_node));
+		assert(parts && nodes);
+		for (size_t i = 0; i < n; ++i) {
+			nodes[i].from = 2 + (factorial_n - 1) * i / n, nodes[i].to = 1 + (factorial_n - 1) * (i + 1) / n;
+			cint_init(parts + i, (nodes[i].to - nodes[i].from + 2) * bits, 0);
+			nodes[i].lhs = parts + i;
+		}
+		h_cint_pool_run(pool, h_cint_range_task, nodes, sizeof(*nodes), n);
+		for (; n > 2; n = (n + 1) >> 1) {
+			for (size_t i = 0; i < n >> 1; ++i)
+				nodes[i].lhs = parts + 2 * i, nodes[i].rhs = parts + 2 * i + 1;
+			h_cint_pool_run(pool, h_cint_product_task, nodes, sizeof(*nodes), n >> 1);
+			for (size_t i = 0; i < n; i += 2) {
+				cint tmp = parts[i >> 1];
+				parts[i >> 1] = parts[i], parts[i] = tmp; // move the products at the beginning.
+			}
+		}
+		n == 2 ? cint_mul_parallel(pool, parts, parts + 1, res) : cint_dup(res, parts);
+		for (size_t i = 0; i < 4 * (pool->n_threads + 1); ++i)
+			free(parts[i].mem);
+		free(parts), free(nodes);
+	}
+}
+
+#endif
+
+__attribute__((unused)) static inline void cint_mul_mod(cint_sheet *sheet, const cint *lhs, const cint *rhs, const cint *mod, cint *res) {
+	cint *a = h_cint_tmp(sheet, 2, res), *b = h_cint_tmp(sheet, 3, res);
+	cint_mul(lhs, rhs, a);
+	cint_div(sheet, a, mod, b, res);
+}
+
+static inline void cint_mul_modi(cint_sheet *sheet, cint *lhs, const cint *rhs, const cint *mod) {
+	H_CINT_BEGIN(sheet, CINT_STAT_MUL_MOD, mod);
+	cint *a = h_cint_tmp(sheet, 2, lhs), *b = h_cint_tmp(sheet, 3, lhs);
+	cint_mul(lhs, rhs, a);
+	cint_div(sheet, a, mod, b, lhs);
+	H_CINT_END(sheet, CINT_STAT_MUL_MOD);
+}
+
+static inline void cint_pow_modi(cint_sheet *sheet, cint *n, const cint *exp, const cint *mod) {
+	// same as "power" algorithm, difference is that it take the modulo as soon as possible.
+	H_CINT_BEGIN(sheet, CINT_STAT_POW_MOD, mod);
+	if (n->mem != n->end) {
+		size_t bits = cint_count_bits(exp);
+		switch (bits) {
+			case 0 :
+				cint_reinit(n, n->mem != n->end);
+				break;
+			case 1 :
+				break;
+			default:;
+#ifdef __SIZEOF_INT128__
+				if (mod->mem != mod->end && mod->end <= mod->mem + 2) {
+					// System native exponentiation, the modulus fits a machine word.
+					const h_cint_t nat = *exp->mem & 1 ? n->nat : 1; // the sign of the remainder is the sign of the product.
+					h_cint_reinit_u64(n, h_cint_pow_mod_u64(n, exp, h_cint_to_u64(mod)));
+					n->nat = n->mem != n->end ? nat : 1;
+					break;
+				}
+#endif
+				cint *a = h_cint_tmp(sheet, 2, n);
+				cint *b = h_cint_tmp(sheet, 3, n);
+				cint *c = h_cint_tmp(sheet, 4, n);
+				cint_erase(a), *a->end++ = 1;
+				h_cint_t mask = 1;
+				for (const h_cint_t *ptr = exp->mem;;) {
+					if (*ptr & mask)
+						cint_mul(a, n, b), cint_div(sheet, b, mod, c, a);
+					if (--bits) {
+						cint_mul(n, n, b), cint_div(sheet, b, mod, c, n);
+						mask <<= 1;
+						if (mask == cint_base) mask = 1, ++ptr;
+					} else break;
+				}
+				cint_dup(n, a);
+		}
+	}
+	H_CINT_END(sheet, CINT_STAT_POW_MOD);
+}
+
+__attribute__((unused)) static void cint_pow_mod(cint_sheet *sheet, const cint *n, const cint *exp, const cint *mod, cint *res) {
 	cint_dup(res, n);
 	cint_pow_modi(sheet, res, exp, mod);
 }
 
+typedef struct {
+	cint *odd; // the odd powers of the base modulo "mod": base, base ** 3, base ** 5, ...
+	size_t bits, low; // the bits of the exponent, and the lowest bit of the current window
+	h_cint_t value; // the odd value of the current window, 0 outside of a window
+	int window;
+} h_cint_straus;
+
+static inline int h_cint_straus_window(const size_t bits) {
+	// the window minimizing the multiplications for an exponent of the given bits.
+	return bits < 24 ? 1 : bits < 80 ? 2 : bits < 240 ? 3 : bits < 672 ? 4 : 5;
+}
+
+__attribute__((unused)) static void cint_multi_pow_mod(cint_sheet *sheet, const cint *bases, const cint *exps, const size_t k, const cint *mod, cint *res) {
+	// the product of bases[i] ** exps[i] modulo "mod" (with the sign of the product, like "cint_pow_mod"), the bases
+	// share one chain of squarings, and each one is multiplied by windows of its exponent (interleaved sliding windows).
+	h_cint_straus *s = (h_cint_straus *) calloc(k ? k : 1, sizeof(h_cint_straus));
+	assert(s);
+	size_t bits = 0;
+	const size_t size = 2 * cint_count_bits(mod) + 64;
+	for (size_t i = 0; i < k; ++i) {
+		h_cint_straus *e = s + i;
+		e->bits = cint_count_bits(exps + i), e->window = h_cint_straus_window(e->bits);
+		if (bits < e->bits) bits = e->bits;
+		const size_t n = (size_t) 1 << (e->window - 1);
+		e->odd = (cint *) calloc(n, sizeof(cint));
+		assert(e->odd);
+		for (size_t j = 0; j < n; ++j) cint_init(e->odd + j, size, 0);
+		if (e->bits == 0) continue;
+		cint *q = h_cint_tmp(sheet, 4, bases + i), *r = h_cint_tmp(sheet, 3, bases + i);
+		cint_div(sheet, bases + i, mod, q, r), cint_dup(e->odd, r);
+		if (n > 1) {
+			cint *a = h_cint_tmp(sheet, 3, mod), *b = h_cint_tmp(sheet, 4, mod), *sq = h_cint_tmp(sheet, 5, mod);
+			cint_mul(e->odd, e->odd, a), cint_div(sheet, a, mod, b, sq);
+			for (size_t j = 1; j < n; ++j)
+				cint_mul(e->odd + j - 1, sq, a), cint_div(sheet, a, mod, b, e->odd + j);
+		}
+	}
+	cint *acc = h_cint_tmp(sheet, 2, mod), *a = h_cint_tmp(sheet, 3, mod), *b = h_cint_tmp(sheet, 4, mod);
+	cint_erase(acc), *acc->end++ = 1;
+	int started = 0;
+	for (size_t j = bits; j--;) {
+		if (started) cint_mul(acc, acc, a), cint_div(sheet, a, mod, b, acc);
+		for (size_t i = 0; i < k; ++i) {
+			h_cint_straus *e = s + i;
+			const h_cint_t *x = exps[i].mem;
+			if (e->value == 0 && j < e->bits && x[j / cint_exponent] >> j % cint_exponent & 1) {
+				// a window starts at this bit, it ends on its lowest set bit.
+				e->low = j + 1 > (size_t) e->window ? j + 1 - e->window : 0;
+				while (!(x[e->low / cint_exponent] >> e->low % cint_exponent & 1)) ++e->low;
+				for (size_t l = j + 1; l-- > e->low;) e->value = e->value << 1 | (x[l / cint_exponent] >> l % cint_exponent & 1);
+			}
+			if (e->value && e->low == j)
+				cint_mul(acc, e->odd + (e->value >> 1), a), cint_div(sheet, a, mod, b, acc), e->value = 0, started = 1;
+		}
+	}
+	cint_dup(res, acc);
+	for (size_t i = 0; i < k; ++i) {
+		for (size_t j = 0; j < (size_t) 1 << (s[i].window - 1); ++j) free(s[i].odd[j].mem);
+		free(s[i].odd);
+	}
+	free(s);
+}
+
+static inline uint64_t h_cint_mont_inverse(const uint64_t n) {
+	// the inverse of an odd n modulo 2^64, by Newton iterations (each one doubles the correct bits).
+	uint64_t x = n;
+	for (int i = 0; i < 5; ++i) x *= 2 - n * x;
+	return x;
+}
+
+// The batch functions operate many numbers at once under the same odd modulus, in Montgomery form. The words are
+// stored as a structure of arrays (word j of lane k at j * CINT_BATCH_LANES + k), so the loops over the lanes
+// have no dependency and are vectorized by the compiler.
+
+#ifndef CINT_BATCH_LANES
+#define CINT_BATCH_LANES 4
+#endif
+#ifndef CINT_BATCH_WINDOW
+#define CINT_BATCH_WINDOW 4 // the bits of the exponents processed at once by "cint_pow_mod_batch".
+#endif
+
+typedef struct {
+	size_t s; // the number of words of the modulus
+	uint64_t n_inv, *n, *r2, *t; // -1 / n mod 2^31, the modulus, 2^(62 * s) mod n in lanes, a product in lanes
+} h_cint_batch;
+
+static void h_cint_mont_mul_lanes(const h_cint_batch *ctx, uint64_t *res, const uint64_t *a, const uint64_t *b) {
+	// the Montgomery products res = a * b / 2^(31 * s) mod n of all the lanes (CIOS), "res" can overlap a or b.
+	enum { L = CINT_BATCH_LANES };
+	const size_t s = ctx->s;
+	uint64_t *t = ctx->t, c[L], m[L], u;
+	memset(t, 0, (s + 2) * L * sizeof(*t));
+	for (size_t i = 0; i < s; ++i) {
+		for (size_t k = 0; k < L; ++k) c[k] = 0;
+		for (size_t j = 0; j < s; ++j)
+			for (size_t k = 0; k < L; ++k)
+				u = t[j * L + k] + a[j * L + k] * b[i * L + k] + c[k], t[j * L + k] = u & cint_mask, c[k] = u >> cint_exponent;
+		for (size_t k = 0; k < L; ++k)
+			u = t[s * L + k] + c[k], t[s * L + k] = u & cint_mask, t[(s + 1) * L + k] = u >> cint_exponent;
+		for (size_t k = 0; k < L; ++k)
+			m[k] = t[k] * ctx->n_inv & cint_mask, c[k] = (t[k] + m[k] * ctx->n[0]) >> cint_exponent;
+		for (size_t j = 1; j < s; ++j)
+			for (size_t k = 0; k < L; ++k)
+				u = t[j * L + k] + m[k] * ctx->n[j] + c[k], t[(j - 1) * L + k] = u & cint_mask, c[k] = u >> cint_exponent;
+		for (size_t k = 0; k < L; ++k)
+			u = t[s * L + k] + c[k], t[(s - 1) * L + k] = u & cint_mask, t[s * L + k] = t[(s + 1) * L + k] + (u >> cint_exponent);
+	}
+	// the products are lower than 2n, subtract n from those which are greater than or equal to n.
+	for (size_t k = 0; k < L; ++k) c[k] = 0;
+	for (size_t j = 0; j < s; ++j)
+		for (size_t k = 0; k < L; ++k)
+			u = t[j * L + k] - ctx->n[j] - c[k], res[j * L + k] = u & cint_mask, c[k] = u >> 63;
+	for (size_t k = 0; k < L; ++k)
+		m[k] = 0 - (uint64_t) (c[k] > t[s * L + k]); // all ones when the product was lower than n
+	for (size_t j = 0; j < s; ++j)
+		for (size_t k = 0; k < L; ++k)
+			res[j * L + k] = (t[j * L + k] & m[k]) | (res[j * L + k] & ~m[k]);
+}
+
+static void h_cint_batch_load(cint_sheet *sheet, const h_cint_batch *ctx, const cint *num, const cint *mod, uint64_t *lanes, const size_t k) {
+	// write the non-negative residue of a number in the lane "k", then convert it into Montgomery form.
+	const cint *x = num;
+	if (num->nat < 0 || h_cint_compare(num, mod) >= 0) {
+		cint *q = h_cint_tmp(sheet, 3, num), *r = h_cint_tmp(sheet, 4, num);
+		cint_div(sheet, num, mod, q, r);
+		if (r->nat < 0) cint_addi(r, mod);
+		x = r;
+	}
+	for (size_t j = 0; j < ctx->s; ++j)
+		lanes[j * CINT_BATCH_LANES + k] = (uint64_t) (x->mem + j < x->end ? x->mem[j] : 0);
+}
+
+static void h_cint_batch_store(const h_cint_batch *ctx, const uint64_t *lanes, const size_t k, cint *res) {
+	cint_erase(res);
+	for (size_t j = 0; j < ctx->s; ++j)
+		res->mem[j] = (h_cint_t) lanes[j * CINT_BATCH_LANES + k];
+	for (res->end = res->mem + ctx->s; res->end > res->mem && !*(res->end - 1); --res->end);
+}
+
+static uint64_t *h_cint_batch_init(cint_sheet *sheet, h_cint_batch *ctx, const cint *mod, const size_t n_buffers) {
+	// prepare the modulus, and return a memory of "n_buffers" numbers in lanes (to be freed).
+	enum { L = CINT_BATCH_LANES };
+	assert(*mod->mem & 1); // Montgomery form requires an odd modulus.
+	const size_t s = ctx->s = mod->end - mod->mem;
+	uint64_t *mem = (uint64_t *) calloc((2 * s + s + 2) * L + (n_buffers * s * L), sizeof(uint64_t));
+	assert(mem);
+	ctx->n = mem, ctx->r2 = mem + s, ctx->t = mem + s + s * L;
+	for (size_t j = 0; j < s; ++j)
+		ctx->n[j] = (uint64_t) mod->mem[j];
+	ctx->n_inv = (0 - h_cint_mont_inverse(ctx->n[0])) & cint_mask;
+	cint *r = h_cint_tmp(sheet, 2, mod), *a = h_cint_tmp(sheet, 3, mod), *b = h_cint_tmp(sheet, 4, mod);
+	cint_erase(r), *r->end++ = 1, cint_left_shifti(r, 2 * cint_exponent * s);
+	cint_div(sheet, r, mod, a, b);
+	for (size_t k = 0; k < L; ++k)
+		h_cint_batch_load(sheet, ctx, b, mod, ctx->r2, k);
+	return mem + (2 * s + s + 2) * L;
+}
+
+__attribute__((unused)) static void cint_mul_mod_batch(cint_sheet *sheet, const cint *lhs, const cint *rhs, const cint *mod, cint *res, const size_t n) {
+	// res[i] = lhs[i] * rhs[i] mod "mod" for the "n" numbers, the modulus is odd and the results are non-negative.
+	enum { L = CINT_BATCH_LANES };
+	h_cint_batch ctx;
+	uint64_t *a = h_cint_batch_init(sheet, &ctx, mod, 2), *b = a + ctx.s * L;
+	for (size_t i = 0; i < n; i += L) {
+		for (size_t k = 0; k < L; ++k)
+			h_cint_batch_load(sheet, &ctx, lhs + (i + k < n ? i + k : i), mod, a, k), h_cint_batch_load(sheet, &ctx, rhs + (i + k < n ? i + k : i), mod, b, k);
+		h_cint_mont_mul_lanes(&ctx, a, a, b);
+		h_cint_mont_mul_lanes(&ctx, a, a, ctx.r2);
+		for (size_t k = 0; k < L && i + k < n; ++k)
+			h_cint_batch_store(&ctx, a, k, res + i + k);
+	}
+	free(ctx.n);
+}
+
+static void h_cint_pow_mod_batch(cint_sheet *sheet, const cint *bases, const cint *exps, const cint *mod, cint *res, const size_t n, const size_t W) {
+	// the lanes share a window of W bits, using a table of the 2^W first powers of every base.
+	enum { L = CINT_BATCH_LANES };
+	h_cint_batch ctx;
+	uint64_t *table = h_cint_batch_init(sheet, &ctx, mod, ((size_t) 1 << W) + 2), *x = table + (((size_t) 1 << W) * ctx.s * L), *g = x + ctx.s * L;
+	const size_t s = ctx.s;
+	for (size_t i = 0; i < n; i += L) {
+		size_t bits = 0;
+		memset(x, 0, s * L * sizeof(*x));
+		for (size_t k = 0; k < L; ++k) {
+			const size_t e = i + k < n ? cint_count_bits(exps + i + k) : 0;
+			if (bits < e) bits = e;
+			h_cint_batch_load(sheet, &ctx, bases + (i + k < n ? i + k : i), mod, table + s * L, k);
+			x[k] = 1;
+		}
+		h_cint_mont_mul_lanes(&ctx, table, x, ctx.r2); // the Montgomery form of 1
+		h_cint_mont_mul_lanes(&ctx, table + s * L, table + s * L, ctx.r2);
+		for (size_t d = 2; d < (size_t) 1 << W; ++d)
+			h_cint_mont_mul_lanes(&ctx, table + d * s * L, table + (d - 1) * s * L, table + s * L);
+		memcpy(x, table, s * L * sizeof(*x));
+		for (size_t w = (bits + W - 1) / W; w--;) {
+			for (size_t sq = 0; sq < W; ++sq)
+				h_cint_mont_mul_lanes(&ctx, x, x, x);
+			for (size_t k = 0; k < L; ++k) {
+				size_t d = 0;
+				if (i + k < n)
+					for (size_t bit = w * W + W; bit-- > w * W;)
+						d = d << 1 | (bit < (size_t) (exps[i + k].end - exps[i + k].mem) * cint_exponent && exps[i + k].mem[bit / cint_exponent] >> bit % cint_exponent & 1);
+				for (size_t j = 0; j < s; ++j)
+					g[j * L + k] = table[(d * s + j) * L + k];
+			}
+			h_cint_mont_mul_lanes(&ctx, x, x, g);
+		}
+		memset(g, 0, s * L * sizeof(*g));
+		for (size_t k = 0; k < L; ++k) g[k] = 1;
+		h_cint_mont_mul_lanes(&ctx, x, x, g); // back from the Montgomery form
+		for (size_t k = 0; k < L && i + k < n; ++k)
+			h_cint_batch_store(&ctx, x, k, res + i + k);
+	}
+	free(ctx.n);
+}
+
+__attribute__((unused)) static inline void cint_pow_mod_batch(cint_sheet *sheet, const cint *bases, const cint *exps, const cint *mod, cint *res, const size_t n) {
+	// res[i] = bases[i] ** exps[i] mod "mod" for the "n" numbers, the modulus is odd and the results are non-negative.
+	h_cint_pow_mod_batch(sheet, bases, exps, mod, res, n, CINT_BATCH_WINDOW);
+}
+
+#ifndef CINT_BINARY_GCD_THRESHOLD
+#define CINT_BINARY_GCD_THRESHOLD 3 // the words of the operands from which "cint_gcd" uses the binary GCD.
+#endif
+
+static void cint_binary_gcd(cint_sheet *sheet, const cint *lhs, const cint *rhs, cint *gcd);
+
 __attribute__((unused)) static void cint_gcd(cint_sheet *sheet, const cint *lhs, const cint *rhs, cint *gcd) {
 	// the basic GCD algorithm, by frontal divisions.
-	if (rhs->mem == rhs->end)
+	H_CINT_BEGIN(sheet, CINT_STAT_GCD, lhs);
+	if ((size_t) (lhs->end - lhs->mem) >= CINT_BINARY_GCD_THRESHOLD && (size_t) (rhs->end - rhs->mem) >= CINT_BINARY_GCD_THRESHOLD)
+		cint_binary_gcd(sheet, lhs, rhs, gcd);
+	else if (lhs->end <= lhs->mem + 2 && rhs->end <= rhs->mem + 2) {
+		// System native GCD.
+		uint64_t a = h_cint_to_u64(lhs), b = h_cint_to_u64(rhs), t;
+		for (; b; t = a % b, a = b, b = t);
+		h_cint_reinit_u64(gcd, a);
+	} else if (rhs->mem == rhs->end)
 		cint_dup(gcd, lhs), gcd->nat = 1;
 	else {
 		cint *A = h_cint_tmp(sheet, 2, lhs),
@@ -561,19 +1896,19 @@ __attribute__((unused)) static void cint_gcd(cint_sheet *sheet, const cint *lhs,
 		gcd->nat = 1;
 		if (RES != gcd) cint_dup(RES, gcd);
 	}
-
+	H_CINT_END(sheet, CINT_STAT_GCD);
 }
 
-__attribute__((unused)) static void cint_binary_gcd(cint_sheet *sheet, const cint *lhs, const cint *rhs, cint *gcd) {
+static void cint_binary_gcd(cint_sheet *sheet, const cint *lhs, const cint *rhs, cint *gcd) {
 	// a binary GCD algorithm.
 	if (lhs->mem == lhs->end) cint_dup(gcd, rhs);
 	else if (rhs->mem == rhs->end) cint_dup(gcd, lhs);
 	else {
 		cint *tmp = h_cint_tmp(sheet, 0, lhs),
 				*swap, *res = gcd;
-		cint_dup(gcd, lhs), gcd->nat = 1;
-		cint_dup(tmp, rhs), tmp->nat = 1;
 		const size_t a = cint_count_zeros(lhs), b = cint_count_zeros(rhs);
+		cint_dup(gcd, lhs), gcd->nat = 1, cint_right_shifti(gcd, a); // both numbers are odd from here
+		cint_dup(tmp, rhs), tmp->nat = 1, cint_right_shifti(tmp, b);
 		for (size_t c = a > b ? b : a;; cint_right_shifti(tmp, cint_count_zeros(tmp))) {
 			if (h_cint_compare(gcd, tmp) > 0)
 				swap = gcd, gcd = tmp, tmp = swap;
@@ -601,18 +1936,36 @@ static unsigned cint_remove(cint_sheet *sheet, cint *N, const cint *F) {
 				if (res) N->nat *= F->nat;
 				break;
 			default:;
-				cint *A = h_cint_tmp(sheet, 2, N), *B = h_cint_tmp(sheet, 3, N);
-				// divides N by the factor until there is a remainder
-				for (cint *tmp; cint_div(sheet, N, F, A, B), B->mem == B->end; tmp = N, N = A, A = tmp, ++res);
-				if (res & 1) cint_dup(A, N);
+				// N is divided by F, F², F⁴... while they divide it, then by the same powers in the reverse order, so
+				// a multiplicity k costs O(log k) exact divisions.
+				cint powers[8 * sizeof(size_t)];
+				const cint *P = F;
+				size_t i = 0, k = 0;
+				for (; cint_is_divisible(sheet, N, P); ++i) {
+					cint_divexact(sheet, N, P, N), res += (size_t) 1 << i;
+					if (2 * cint_count_bits(P) - 1 > cint_count_bits(N)) { ++i; break; } // the square is too large.
+					cint_init(powers + k, 2 * cint_count_bits(P), 0), cint_mul(P, P, powers + k), P = powers + k++;
+				}
+				for (size_t j = i; j--;)
+					if (P = j ? powers + j - 1 : F, cint_is_divisible(sheet, N, P))
+						cint_divexact(sheet, N, P, N), res += (size_t) 1 << j;
+				for (size_t j = 0; j < k; ++j) free(powers[j].mem);
 		}
 	return res;
 }
 
 static void cint_sqrt(cint_sheet *sheet, const cint *num, cint *res, cint *rem) {
 	// original square root algorithm.
+	H_CINT_BEGIN(sheet, CINT_STAT_SQRT, num);
 	cint_erase(res), cint_dup(rem, num); // answer ** 2 + rem = num
-	if (num->nat > 0 && num->end != num->mem) {
+	if (num->nat > 0 && num->end != num->mem && num->end <= num->mem + 2) {
+		// System native square root.
+		uint64_t x = h_cint_to_u64(num), r = 0, a = 1ULL << ((cint_count_bits(num) - 1) & ~1);
+		for (; a; a >>= 2)
+			if (x >= r + a) x -= r + a, r = (r >> 1) + a;
+			else r >>= 1;
+		h_cint_reinit_u64(res, r), h_cint_reinit_u64(rem, x);
+	} else if (num->nat > 0 && num->end != num->mem) {
 		cint *a = h_cint_tmp(sheet, 0, num), *b = h_cint_tmp(sheet, 1, num);
 		cint_erase(a), *a->end++ = 1;
 		cint_left_shifti(a, cint_count_bits(num) & ~1);
@@ -625,6 +1978,7 @@ static void cint_sqrt(cint_sheet *sheet, const cint *num, cint *res, cint *rem)
 			cint_right_shifti(a, 2);
 		}
 	}
+	H_CINT_END(sheet, CINT_STAT_SQRT);
 }
 
 static void cint_cbrt(cint_sheet *sheet, const cint *num, cint *res, cint *rem) {
@@ -637,9 +1991,7 @@ static void cint_cbrt(cint_sheet *sheet, const cint *num, cint *res, cint *rem)
 			cint_dup(a, res);
 			cint_left_shifti(a, 1);
 			h_cint_addi(a, res);
-			cint_mul(a, res, b);
-			++*b->mem; // "b" isn't "normalized", it should work for an addition.
-			h_cint_addi(b, a);
+			cint_dup(b, a), cint_addmul(b, a, res), h_cint_addi_u64(b, 1); // 3 * res² + 3 * res + 1
 			cint_dup(a, rem);
 			cint_right_shifti(a, c);
 			if (h_cint_compare(a, b) >= 0)
@@ -673,12 +2025,11 @@ static void cint_nth_root(cint_sheet *sheet, const cint *num, const unsigned nth
 						*e = h_cint_tmp(sheet, 6, num), *r = res, *tmp;
 				cint_erase(a), *a->end++ = 1, cint_erase(d), *d->end++ = 1;
 				cint_left_shifti(a, (cint_count_bits(num) + nth - 1) / nth);
-				h_cint_addi(r, d), cint_reinit(d, nth - 1), cint_reinit(e, nth);
+				h_cint_addi(r, d), cint_reinit(e, nth);
 				do {
 					tmp = a, a = r, r = tmp, cint_dup(a, num);
 					for (unsigned count = nth; --count && (cint_div(sheet, a, r, b, c), tmp = a, a = b, b = tmp, a->mem != a->end););
-					cint_mul(r, d, b);
-					h_cint_addi(b, a);
+					cint_dup(b, a), b->nat = 1, cint_addmul_ui(b, r, nth - 1);
 					cint_div(sheet, b, e, a, c);
 				} while (h_cint_compare(a, r) < 0);
 				r == res ? (void) 0 : cint_dup(res, tmp == a ? a : r);
@@ -713,65 +2064,1119 @@ static void cint_random_bits(cint *num, size_t bits, uint64_t *seed) {
 	}
 }
 
+// The xoshiro256** generator (Blackman and Vigna) has a period of 2^256 - 1, "cint_rng_jump" advances it by 2^128
+// draws, so the streams separated by jumps don't overlap: the thread i of a computation takes a copy of the generator
+// jumped i times, and the results don't depend on the scheduling. A draw gives 2 words of 31 bits.
+
+typedef struct {
+	uint64_t s[4];
+} cint_rng;
+
+static inline uint64_t h_cint_rotl(const uint64_t x, const int k) { return x << k | x >> (64 - k); }
+
+__attribute__((unused)) static void cint_rng_init(cint_rng *rng, uint64_t seed) {
+	// the state is expanded from the seed by SplitMix64.
+	for (int i = 0; i < 4; ++i) {
+		uint64_t z = seed += 0x9e3779b97f4a7c15;
+		z = (z ^ z >> 30) * 0xbf58476d1ce4e5b9, z = (z ^ z >> 27) * 0x94d049bb133111eb;
+		rng->s[i] = z ^ z >> 31;
+	}
+}
+
+static inline uint64_t cint_rng_next(cint_rng *rng) {
+	uint64_t *s = rng->s;
+	const uint64_t res = h_cint_rotl(s[1] * 5, 7) * 9, t = s[1] << 17;
+	s[2] ^= s[0], s[3] ^= s[1], s[1] ^= s[2], s[0] ^= s[3], s[2] ^= t, s[3] = h_cint_rotl(s[3], 45);
+	return res;
+}
+
+__attribute__((unused)) static void cint_rng_jump(cint_rng *rng) {
+	// equivalent to 2^128 calls of "cint_rng_next".
+	static const uint64_t jump[] = {0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa, 0x39abdc4529b1661c};
+	uint64_t s[4] = {0};
+	for (int i = 0; i < 4; ++i)
+		for (int b = 0; b < 64; ++b, cint_rng_next(rng))
+			if (jump[i] >> b & 1)
+				for (int j = 0; j < 4; ++j) s[j] ^= rng->s[j];
+	memcpy(rng->s, s, sizeof(s));
+}
+
+static void h_cint_rng_fill(cint *num, const size_t bits, cint_rng *rng) {
+	// a uniform number of [0, 2^bits).
+	const size_t words = (bits + cint_exponent - 1) / cint_exponent;
+	cint_erase(num);
+	for (size_t i = 0; i < words; i += 2) {
+		const uint64_t r = cint_rng_next(rng);
+		num->mem[i] = (h_cint_t) (r & cint_mask);
+		if (i + 1 < words) num->mem[i + 1] = (h_cint_t) (r >> cint_exponent & cint_mask);
+	}
+	if (bits % cint_exponent) num->mem[words - 1] &= ((h_cint_t) 1 << bits % cint_exponent) - 1;
+	for (num->end = num->mem + words; num->end > num->mem && !*(num->end - 1); --num->end);
+}
+
+__attribute__((unused)) static void cint_rng_bits(cint *num, const size_t bits, cint_rng *rng) {
+	// provide a positive random number having exactly the requested number of bits, like "cint_random_bits".
+	h_cint_rng_fill(num, bits, rng);
+	if (bits) num->mem[(bits - 1) / cint_exponent] |= (h_cint_t) 1 << (bits - 1) % cint_exponent, num->end = num->mem + (bits + cint_exponent - 1) / cint_exponent;
+}
+
+__attribute__((unused)) static void cint_random_below(cint *res, const cint *bound, cint_rng *rng) {
+	// a uniform number of [0, |bound|), by rejection of the numbers having as many bits as the bound (there are less
+	// than 2 draws of the bits on average), so it's unbiased.
+	assert(bound->mem != bound->end);
+	const size_t bits = cint_count_bits(bound);
+	do h_cint_rng_fill(res, bits, rng);
+	while (h_cint_compare(res, bound) >= 0);
+}
+
+// The vector holds many numbers in a single allocation: the views, then the words of the numbers, contiguous. The
+// views are usable by all the functions, except "cint_rescale" (their memory isn't allocated separately).
+
+typedef struct {
+	size_t n;
+	cint *nums; // the views, the number i has the capacity of "cint_init" for its bits
+	h_cint_t *arena; // the words of the numbers, the number i starts where the number i - 1 ends
+} cint_vector;
+
+static cint_vector *h_cint_new_vector(const size_t n, const size_t *bits, const size_t step) {
+	// the number i has bits[i * step] bits, so a step of 0 gives the same capacity to all the numbers.
+	size_t words = 0, i;
+	for (i = 0; i < n; ++i) words += bits[i * step] / cint_exponent + 8 - bits[i * step] / cint_exponent % 4;
+	cint_vector *vec = (cint_vector *) calloc(1, sizeof(cint_vector) + n * sizeof(cint) + words * sizeof(h_cint_t));
+	assert(vec);
+	vec->n = n, vec->nums = (cint *) (vec + 1), vec->arena = (h_cint_t *) (vec->nums + n);
+	h_cint_t *p = vec->arena;
+	for (i = 0; i < n; p += vec->nums[i++].size) {
+		vec->nums[i].size = bits[i * step] / cint_exponent, vec->nums[i].size += 8 - vec->nums[i].size % 4;
+		vec->nums[i].mem = vec->nums[i].end = p, vec->nums[i].nat = 1;
+	}
+	return vec;
+}
+
+__attribute__((unused)) static inline cint_vector *cint_new_vector(const size_t n, const size_t bits) { return h_cint_new_vector(n, &bits, 0); }
+
+__attribute__((unused)) static inline cint_vector *cint_new_vector_varying(const size_t n, const size_t *bits) { return h_cint_new_vector(n, bits, 1); }
+
+__attribute__((unused)) static void cint_vector_random_bits(cint_vector *vec, const size_t bits, uint64_t *seed) {
+	for (size_t i = 0; i < vec->n; ++i) cint_random_bits(vec->nums + i, bits, seed);
+}
+
+__attribute__((unused)) static inline void cint_clear_vector(cint_vector *vec) { free(vec); }
+
+// The table maps numbers to machine words by open addressing (linear probing), its keys are copied into an arena
+// and prefixed by their signed length. A slot takes 24 bytes, the table doubles when it's 3/4 full, so the memory
+// is 64 bytes per entry at most, plus the words of the keys. The keys are compared only when their hashes are equal.
+
+typedef struct {
+	uint64_t hash; // 0 for an empty slot
+	size_t offset; // the key is at arena[offset + 1], arena[offset] is its signed length
+	uint64_t value;
+} cint_table_slot;
+
+typedef struct {
+	size_t n, capacity; // the entries, and the slots (a power of two)
+	cint_table_slot *slots;
+	h_cint_t *arena;
+	size_t used, size; // the words of the arena
+} cint_table;
+
+static uint64_t cint_hash(const cint *num) {
+	// the words are mixed by 4 independent lanes (the multiplications overlap), then finalized like MurmurHash3.
+	uint64_t h[4] = {0x9e3779b97f4a7c15, 0xc2b2ae3d27d4eb4f, 0x165667b19e3779f9, 0x27d4eb2f165667c5}, res;
+	const h_cint_t *p = num->mem;
+	for (; p + 4 <= num->end; p += 4)
+		for (int i = 0; i < 4; ++i)
+			h[i] = (h[i] ^ (uint64_t) p[i]) * 0xff51afd7ed558ccd;
+	for (int i = 0; p < num->end; ++i) h[i] = (h[i] ^ (uint64_t) *p++) * 0xff51afd7ed558ccd;
+	res = h[0] ^ (h[1] << 17 | h[1] >> 47) ^ (h[2] << 31 | h[2] >> 33) ^ (h[3] << 47 | h[3] >> 17);
+	res ^= (uint64_t) (num->end - num->mem) * (uint64_t) num->nat;
+	res ^= res >> 33, res *= 0xff51afd7ed558ccd, res ^= res >> 33, res *= 0xc4ceb9fe1a85ec53, res ^= res >> 33;
+	return res + !res; // never 0
+}
+
+__attribute__((unused)) static cint_table *cint_new_table(const size_t expected) {
+	// a table sized for "expected" entries without growing, released by "cint_clear_table".
+	cint_table *table = (cint_table *) calloc(1, sizeof(cint_table));
+	assert(table);
+	for (table->capacity = 16; table->capacity / 4 * 3 < expected; table->capacity <<= 1);
+	table->slots = (cint_table_slot *) calloc(table->capacity, sizeof(cint_table_slot));
+	table->size = 4 * table->capacity;
+	table->arena = (h_cint_t *) malloc(table->size * sizeof(h_cint_t));
+	assert(table->slots && table->arena);
+	return table;
+}
+
+__attribute__((unused)) static void cint_clear_table(cint_table *table) {
+	free(table->slots);
+	free(table->arena);
+	free(table);
+}
+
+static cint_table_slot *h_cint_table_slot(const cint_table *table, const cint *key, const uint64_t hash) {
+	// the slot of the key, or the empty slot where it would be inserted.
+	cint_table_slot *slot;
+	for (size_t i = hash & (table->capacity - 1);; i = (i + 1) & (table->capacity - 1))
+		if (slot = table->slots + i, slot->hash == 0) return slot;
+		else if (slot->hash == hash) {
+			h_cint_t *k = table->arena + slot->offset;
+			const cint view = {k + 1, k + 1 + (*k < 0 ? -*k : *k), *k < 0 ? -1 : 1, 0};
+			if (cint_compare(&view, key) == 0) return slot;
+		}
+}
+
+__attribute__((unused)) static uint64_t *cint_table_find(const cint_table *table, const cint *key) {
+	// the value of the key, or NULL when it's absent.
+	cint_table_slot *slot = h_cint_table_slot(table, key, cint_hash(key));
+	return slot->hash ? &slot->value : 0;
+}
+
+static void h_cint_table_grow(cint_table *table) {
+	// the slots are doubled, the hashes are kept, so the keys are not read.
+	const size_t capacity = table->capacity;
+	cint_table_slot *slots = table->slots;
+	table->capacity <<= 1;
+	table->slots = (cint_table_slot *) calloc(table->capacity, sizeof(cint_table_slot));
+	assert(table->slots);
+	for (size_t i = 0, j; i < capacity; ++i)
+		if (slots[i].hash) {
+			for (j = slots[i].hash & (table->capacity - 1); table->slots[j].hash; j = (j + 1) & (table->capacity - 1));
+			table->slots[j] = slots[i];
+		}
+	free(slots);
+}
+
+__attribute__((unused)) static int cint_table_put(cint_table *table, const cint *key, const uint64_t value) {
+	// associate the value to the key, returns 1 when the key is added, 0 when its value is replaced.
+	const uint64_t hash = cint_hash(key);
+	cint_table_slot *slot = h_cint_table_slot(table, key, hash);
+	if (slot->hash) return slot->value = value, 0;
+	if (table->n + 1 > table->capacity / 4 * 3)
+		h_cint_table_grow(table), slot = h_cint_table_slot(table, key, hash);
+	const size_t words = key->end - key->mem;
+	if (table->used + words + 1 > table->size) {
+		for (; table->used + words + 1 > table->size; table->size <<= 1);
+		table->arena = (h_cint_t *) realloc(table->arena, table->size * sizeof(h_cint_t));
+		assert(table->arena);
+	}
+	slot->hash = hash, slot->offset = table->used, slot->value = value, ++table->n;
+	table->arena[table->used++] = (h_cint_t) words * key->nat;
+	memcpy(table->arena + table->used, key->mem, words * sizeof(h_cint_t)), table->used += words;
+	return 1;
+}
+
 __attribute__((unused)) static void cint_modular_inverse(cint_sheet *sheet, const cint *lhs, const cint *rhs, cint *res) {
 	// original modular inverse algorithm, answer is also called "u1" in extended Euclidean algorithm context.
+	H_CINT_BEGIN(sheet, CINT_STAT_MODULAR_INVERSE, rhs);
 	if (*rhs->mem > 1 || rhs->end > rhs->mem + 1) {
 		cint *a = h_cint_tmp(sheet, 2, rhs),
 				*b = h_cint_tmp(sheet, 3, rhs),
 				*c = h_cint_tmp(sheet, 4, rhs),
 				*d = h_cint_tmp(sheet, 5, rhs),
-				*e = h_cint_tmp(sheet, 6, rhs),
-				*f = h_cint_tmp(sheet, 7, rhs), *tmp, *out = res;
+				*e = h_cint_tmp(sheet, 6, rhs), *tmp, *out = res;
 		cint_dup(a, lhs), cint_dup(b, rhs), cint_erase(res), *res->end++ = 1, cint_erase(e);
 		a->nat = b->nat = 1;
 		int i = 0;
 		do {
 			cint_div(sheet, a, b, c, d);
-			cint_mul(c, e, f);
-			cint_dup(c, res);
-			cint_subi(c, f);
+			cint_submul(res, c, e); // res - c * e, in place
 			tmp = a, a = b, b = d, d = tmp;
-			tmp = res, res = e, e = c, c = tmp;
+			tmp = res, res = e, e = tmp;
 		} while (++i, (d->mem == d->end) == (b->mem == b->end));
 		if (a->end == a->mem + 1 && *a->mem == 1) {
 			if (i & 1) cint_addi(res, e);
 		} else cint_erase(res);
 		if (out != res) cint_dup(out, res);
 	} else cint_erase(res);
+	H_CINT_END(sheet, CINT_STAT_MODULAR_INVERSE);
 }
 
-int cint_is_prime(cint_sheet *sheet, const cint *N, int iterations, uint64_t *seed) {
-	// is N is considered as a prime number ? the function returns 0 or 1.
-	// when the number of Miller-Rabin iterations is zero, it's automatic.
+// The CRT context holds the product tree of pairwise coprime moduli, it reduces a number modulo all of them by a
+// remainder tree (a division per node instead of a division of the number per modulus), and it rebuilds a number
+// from its residues by combining the products bottom-up, with the inverses computed once by "cint_crt_build".
+
+typedef struct {
+	size_t n;
+	cint *tree; // the products of the moduli, node 0 is the product of all, the children of node i are 2i + 1 and 2i + 2
+	cint *work; // a number per node, it holds the remainders and the partial combinations
+	cint *inverses; // (M / m_i) ** -1 mod m_i, where M is the product of the moduli
+} cint_crt;
+
+static void h_cint_crt_mod(cint_sheet *sheet, const cint *num, const cint *mod, cint *res) {
+	// the non-negative residue, "res" may be smaller than "num".
+	cint *q = h_cint_tmp(sheet, 3, num), *r = h_cint_tmp(sheet, 4, num);
+	cint_div(sheet, num, mod, q, r);
+	if (r->nat < 0 && r->mem != r->end) cint_addi(r, mod);
+	cint_dup(res, r);
+}
+
+static void h_cint_crt_tree(cint_crt *crt, const cint *moduli, const size_t node, const size_t lo, const size_t hi) {
+	cint *t = crt->tree;
+	if (hi - lo == 1) {
+		assert(moduli[lo].nat > 0 && moduli[lo].mem != moduli[lo].end);
+		cint_init(t + node, cint_count_bits(moduli + lo), 0), cint_dup(t + node, moduli + lo);
+		cint_init(crt->inverses + lo, cint_count_bits(t + node) + 64, 0);
+	} else {
+		const size_t mid = lo + (hi - lo) / 2, l = 2 * node + 1, r = 2 * node + 2;
+		h_cint_crt_tree(crt, moduli, l, lo, mid), h_cint_crt_tree(crt, moduli, r, mid, hi);
+		cint_init(t + node, cint_count_bits(t + l) + cint_count_bits(t + r) + 64, 0);
+		cint_mul(t + l, t + r, t + node);
+	}
+	// the partial combinations are lower than (hi - lo) times the product.
+	cint_init(crt->work + node, cint_count_bits(t + node) + 4 * cint_exponent, 0);
+}
+
+static void h_cint_crt_cofactors(cint_sheet *sheet, cint_crt *crt, const size_t node, const size_t lo, const size_t hi) {
+	// work[node] is M / tree[node] modulo tree[node], the leaves receive its inverse.
+	cint *w = crt->work, *t = crt->tree;
+	if (hi - lo == 1) {
+		cint_modular_inverse(sheet, w + node, t + node, crt->inverses + lo);
+		assert(crt->inverses[lo].mem != crt->inverses[lo].end || (t[node].end == t[node].mem + 1 && *t[node].mem == 1));
+	} else {
+		const size_t mid = lo + (hi - lo) / 2, l = 2 * node + 1, r = 2 * node + 2;
+		cint *a = h_cint_tmp(sheet, 2, t + node);
+		cint_mul(w + node, t + r, a), h_cint_crt_mod(sheet, a, t + l, w + l);
+		cint_mul(w + node, t + l, a), h_cint_crt_mod(sheet, a, t + r, w + r);
+		h_cint_crt_cofactors(sheet, crt, l, lo, mid), h_cint_crt_cofactors(sheet, crt, r, mid, hi);
+	}
+}
+
+__attribute__((unused)) static cint_crt *cint_crt_build(cint_sheet *sheet, const cint *moduli, const size_t n) {
+	// the context of "n" positive and pairwise coprime moduli, released by "cint_clear_crt".
+	assert(n);
+	cint_crt *crt = (cint_crt *) calloc(1, sizeof(cint_crt));
+	assert(crt);
+	crt->n = n;
+	crt->tree = (cint *) calloc(3 * 4 * n, sizeof(cint));
+	assert(crt->tree);
+	crt->work = crt->tree + 4 * n, crt->inverses = crt->work + 4 * n;
+	h_cint_crt_tree(crt, moduli, 0, 0, n);
+	cint_reinit(crt->work, 1), h_cint_crt_mod(sheet, crt->work, crt->tree, crt->work);
+	h_cint_crt_cofactors(sheet, crt, 0, 0, n);
+	return crt;
+}
+
+__attribute__((unused)) static void cint_clear_crt(cint_crt *crt) {
+	for (size_t i = 0; i < 3 * 4 * crt->n; ++i)
+		free(crt->tree[i].mem);
+	free(crt->tree);
+	free(crt);
+}
+
+static void h_cint_crt_reduce(cint_sheet *sheet, cint_crt *crt, cint *res, const size_t node, const size_t lo, const size_t hi) {
+	cint *w = crt->work;
+	if (hi - lo == 1)
+		cint_dup(res + lo, w + node);
+	else {
+		const size_t mid = lo + (hi - lo) / 2, l = 2 * node + 1, r = 2 * node + 2;
+		h_cint_crt_mod(sheet, w + node, crt->tree + l, w + l), h_cint_crt_mod(sheet, w + node, crt->tree + r, w + r);
+		h_cint_crt_reduce(sheet, crt, res, l, lo, mid), h_cint_crt_reduce(sheet, crt, res, r, mid, hi);
+	}
+}
+
+__attribute__((unused)) static void cint_crt_reduce(cint_sheet *sheet, cint_crt *crt, const cint *num, cint *res) {
+	// res[i] = num mod m_i (non-negative) for every modulus, by a remainder tree.
+	h_cint_crt_mod(sheet, num, crt->tree, crt->work);
+	h_cint_crt_reduce(sheet, crt, res, 0, 0, crt->n);
+}
+
+static void h_cint_crt_combine(cint_sheet *sheet, cint_crt *crt, const cint *residues, const size_t node, const size_t lo, const size_t hi) {
+	// work[node] receives the sum of r_i * inverse_i * tree[node] / m_i over its moduli.
+	cint *w = crt->work, *t = crt->tree, *a;
+	if (hi - lo == 1) {
+		h_cint_crt_mod(sheet, residues + lo, t + node, w + node);
+		a = h_cint_tmp(sheet, 2, t + node);
+		cint_mul(w + node, crt->inverses + lo, a), h_cint_crt_mod(sheet, a, t + node, w + node);
+	} else {
+		const size_t mid = lo + (hi - lo) / 2, l = 2 * node + 1, r = 2 * node + 2;
+		h_cint_crt_combine(sheet, crt, residues, l, lo, mid), h_cint_crt_combine(sheet, crt, residues, r, mid, hi);
+		cint_mul(w + l, t + r, w + node);
+		a = h_cint_tmp(sheet, 2, w + node);
+		cint_mul(w + r, t + l, a), cint_addi(w + node, a);
+	}
+}
+
+__attribute__((unused)) static void cint_crt_combine(cint_sheet *sheet, cint_crt *crt, const cint *residues, cint *res) {
+	// the number of [0, M) having the given residues, modulo the moduli of the context.
+	h_cint_crt_combine(sheet, crt, residues, 0, 0, crt->n);
+	h_cint_crt_mod(sheet, crt->work, crt->tree, res);
+}
+
+// Odd primes used by the trial division, the last one squared bounds the numbers it proves prime.
+static const unsigned short cint_small_primes[] = {3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59, 61, 67, 71, 73, 79, 83, 89, 97, 101, 103, 107, 109, 113, 127, 131, 137, 139, 149, 151, 157, 163, 167, 173, 179, 181, 191, 193, 197, 199, 211, 223, 227, 229, 233, 239, 241, 251, 257, 263, 269, 271, 277, 281, 283, 293, 307, 311, 313, 317, 331, 337, 347, 349, 353, 359, 367, 373, 379, 383, 389, 397, 401, 409, 419, 421, 431, 433, 439, 443, 449, 457, 461, 463, 467, 479, 487, 491, 499, 503, 509, 521, 523, 541, 547, 557, 563, 569, 571, 577, 587, 593, 599, 601, 607, 613, 617, 619, 631, 641, 643, 647, 653, 659, 661, 673, 677, 683, 691, 701, 709, 719, 727, 733, 739, 743, 751, 757, 761, 769, 773, 787, 797, 809, 811, 821, 823, 827, 829, 839, 853, 857, 859, 863, 877, 881, 883, 887, 907, 911, 919, 929, 937, 941, 947, 953, 967, 971, 977, 983, 991, 997, 1009, 1013, 1019, 1021};
+
+static int h_cint_presieve(const cint *N) {
+	// trial division of an odd N by the small primes, using one remainder per product of primes.
+	// returns 0 when a small factor is found, 1 when N is proven prime, -1 when it's undecided.
+	const size_t n_primes = sizeof(cint_small_primes) / sizeof(*cint_small_primes);
+	const int small = N->end == N->mem + 1;
+	for (size_t i = 0, j; i < n_primes;) {
+		uint64_t m = 1, r;
+		for (j = i; j < n_primes && m * cint_small_primes[j] < 1ULL << 32; m *= cint_small_primes[j++]);
+		for (r = h_cint_mod_word(N, m); i < j; ++i)
+			if (r % cint_small_primes[i] == 0)
+				return small && *N->mem == cint_small_primes[i];
+	}
+	return small && *N->mem < cint_small_primes[n_primes - 1] * cint_small_primes[n_primes - 1] ? 1 : -1;
+}
+
+static int h_cint_jacobi_u64(uint64_t a, uint64_t n) {
+	// Jacobi symbol (a/n) of machine words, n must be odd.
+	int res = 1;
+	for (a %= n; a; a %= n) {
+		for (; !(a & 1); a >>= 1)
+			if ((n & 7) == 3 || (n & 7) == 5) res = -res;
+		uint64_t t = a;
+		a = n, n = t;
+		if ((a & 3) == 3 && (n & 3) == 3) res = -res;
+	}
+	return n == 1 ? res : 0;
+}
+
+static int h_cint_jacobi_word(long long a, const cint *n) {
+	// Jacobi symbol (a/n) of a machine word "a" and an odd positive n, by reciprocity then natively.
+	int res = 1;
+	uint64_t x = (uint64_t) (a < 0 ? -a : a);
+	if (a < 0 && (*n->mem & 3) == 3) res = -res;
+	if (x == 0) return n->end == n->mem + 1 && *n->mem == 1;
+	for (; !(x & 1); x >>= 1)
+		if ((*n->mem & 7) == 3 || (*n->mem & 7) == 5) res = -res;
+	if ((x & 3) == 3 && (*n->mem & 3) == 3) res = -res;
+	return x == 1 ? res : res * h_cint_jacobi_u64(h_cint_mod_word(n, x), x);
+}
+
+static int h_cint_is_prime_easy(const cint *N) {
+	// decide the numbers that don't need a probable prime test, otherwise return -1.
 	int res;
 	if (0 < N->nat && *N->mem < 961 && N->mem + 1 >= N->end) {
 		int n = (int) *N->mem; // Small numbers for which Miller-Rabin is not used.
 		res = (n > 1) & ((n < 6) * 42 + 0x208A2882) >> n % 30 && (n < 49 || (n % 7 && n % 11 && n % 13 && n % 17 && n % 19 && n % 23 && n % 29));
-	} else if (res = 0 < N->nat && (*N->mem & 1) != 0, res) {
+	} else if (res = 0 < N->nat && (*N->mem & 1) != 0, res)
+		res = h_cint_presieve(N);
+	return res;
+}
+
+static int h_cint_strong_test(cint_sheet *sheet, const cint *N, const cint *N_1, const cint *C, const size_t zeros, cint *B) {
+	// a Miller-Rabin round of base B (overwritten), where N - 1 = C * 2 ** zeros and C is odd.
+	int res = 1;
+	cint_pow_modi(sheet, B, C, N); // raise to the power C mod N
+	if (*B->mem != 1 || B->end != B->mem + 1) {
+		for (size_t b = zeros; b-- && (res = h_cint_compare(N_1, B));)
+			cint_mul_modi(sheet, B, B, N);
+		res = !res;
+	} // only a prime number can hold (res = 1) forever
+	return res;
+}
+
+static inline void h_cint_mod_positive(const cint *N, cint *num) {
+	// bring a number between -2N and 2N back into [0, N).
+	for (; num->nat < 0; cint_addi(num, N));
+	for (; h_cint_compare(num, N) >= 0; h_cint_subi(num, N));
+}
+
+static inline void h_cint_half_mod(const cint *N, cint *num) {
+	// halve a number of [0, 2N) modulo an odd N.
+	if (*num->mem & 1) h_cint_addi(num, N);
+	cint_right_shifti(num, 1);
+	h_cint_mod_positive(N, num);
+}
+
+static int h_cint_strong_lucas(cint_sheet *sheet, const cint *N) {
+	// strong Lucas probable prime test, with the parameters of Selfridge (P = 1, Q = (1 - D) / 4).
+	h_cint_t d_mem[4] = {0}, q_mem[4] = {0};
+	cint D = {d_mem, d_mem, 1, 4}, Q = {q_mem, q_mem, 1, 4};
+	long long d = 5;
+	for (int j; (j = h_cint_jacobi_word(d, N)) != -1; d = d < 0 ? 2 - d : -d - 2)
+		if (j == 0) return 0; // N has a factor in common with D
+		else if (d == 13) { // a perfect square never finds its D
+			cint *root = h_cint_tmp(sheet, 8, N), *rem = h_cint_tmp(sheet, 9, N);
+			cint_sqrt(sheet, N, root, rem);
+			if (rem->mem == rem->end) return 0;
+		}
+	cint_reinit(&D, d), cint_reinit(&Q, (1 - d) / 4);
+	cint *U = h_cint_tmp(sheet, 5, N),
+			*V = h_cint_tmp(sheet, 6, N),
+			*Qk = h_cint_tmp(sheet, 7, N),
+			*K = h_cint_tmp(sheet, 8, N),
+			*T = h_cint_tmp(sheet, 9, N);
+	cint_dup(K, N), cint_erase(U), *U->end++ = 1, h_cint_addi(K, U);
+	const size_t s = cint_count_zeros(K);
+	cint_right_shifti(K, s); // N + 1 = K * 2 ** s
+	cint_dup(V, U), cint_dup(Qk, &Q), h_cint_mod_positive(N, Qk);
+	for (size_t i = cint_count_bits(K) - 1; i--;) {
+		cint_mul_modi(sheet, U, V, N); // U(2k) = U(k) * V(k)
+		cint_mul_modi(sheet, V, V, N), cint_subi(V, Qk), cint_subi(V, Qk), h_cint_mod_positive(N, V); // V(2k) = V(k)² - 2 * Q^k
+		cint_mul_modi(sheet, Qk, Qk, N);
+		if (K->mem[i / cint_exponent] >> i % cint_exponent & 1) {
+			cint_dup(T, U), cint_mul_modi(sheet, T, &D, N), h_cint_mod_positive(N, T);
+			h_cint_addi(U, V), h_cint_half_mod(N, U); // U(k + 1) = (P * U(k) + V(k)) / 2
+			h_cint_addi(V, T), h_cint_half_mod(N, V); // V(k + 1) = (D * U(k) + P * V(k)) / 2
+			cint_mul_modi(sheet, Qk, &Q, N), h_cint_mod_positive(N, Qk);
+		}
+	}
+	int res = U->mem == U->end;
+	for (size_t r = 0; !res && r < s; ++r)
+		if (!(res = V->mem == V->end) && r + 1 < s)
+			cint_mul_modi(sheet, V, V, N), cint_subi(V, Qk), cint_subi(V, Qk), h_cint_mod_positive(N, V), cint_mul_modi(sheet, Qk, Qk, N);
+	return res;
+}
+
+#ifdef __SIZEOF_INT128__
+
+static inline uint64_t h_cint_mont_mul_u64(const uint64_t a, const uint64_t b, const uint64_t n, const uint64_t n_inv) {
+	// the Montgomery product a * b / 2^64 mod n, with n_inv = 1 / n mod 2^64.
+	const h_cint_u128 t = (h_cint_u128) a * b;
+	const uint64_t hi = (uint64_t) (t >> 64), mn = (uint64_t) (((h_cint_u128) ((uint64_t) t * n_inv) * n) >> 64);
+	return hi < mn ? hi - mn + n : hi - mn;
+}
+
+static int h_cint_strong_test_u64(const uint64_t n, const uint64_t base) {
+	// a Miller-Rabin round using the native Montgomery arithmetic, n is odd.
+	const uint64_t n_inv = h_cint_mont_inverse(n), one = (uint64_t) (((h_cint_u128) 1 << 64) % n), minus_one = n - one;
+	uint64_t d = n - 1, x = one, b = (uint64_t) (((h_cint_u128) (base % n) << 64) % n);
+	int s = 0;
+	if (b == 0) return 1;
+	for (; !(d & 1); d >>= 1, ++s);
+	for (; d; d >>= 1, b = h_cint_mont_mul_u64(b, b, n, n_inv))
+		if (d & 1) x = h_cint_mont_mul_u64(x, b, n, n_inv);
+	if (x == one || x == minus_one) return 1;
+	while (--s > 0)
+		if ((x = h_cint_mont_mul_u64(x, x, n, n_inv)) == minus_one) return 1;
+	return 0;
+}
+
+static h_cint_u128 h_cint_mont_mul_u128(const h_cint_u128 a, const h_cint_u128 b, const h_cint_u128 n, const uint64_t n_inv) {
+	// the Montgomery product a * b / 2^128 mod n over two 64-bit words (CIOS), with n < 2^127 and n_inv = -1 / n mod 2^64.
+	const uint64_t A[2] = {(uint64_t) a, (uint64_t) (a >> 64)}, B[2] = {(uint64_t) b, (uint64_t) (b >> 64)}, N[2] = {(uint64_t) n, (uint64_t) (n >> 64)};
+	uint64_t t[4] = {0};
+	for (int i = 0; i < 2; ++i) {
+		h_cint_u128 c = 0;
+		for (int j = 0; j < 2; ++j)
+			c += (h_cint_u128) A[j] * B[i] + t[j], t[j] = (uint64_t) c, c >>= 64;
+		c += t[2], t[2] = (uint64_t) c, t[3] = (uint64_t) (c >> 64);
+		const uint64_t m = t[0] * n_inv;
+		c = ((h_cint_u128) m * N[0] + t[0]) >> 64;
+		c += (h_cint_u128) m * N[1] + t[1], t[0] = (uint64_t) c, c >>= 64;
+		c += t[2], t[1] = (uint64_t) c, c >>= 64;
+		t[2] = t[3] + (uint64_t) c;
+	}
+	const h_cint_u128 res = (h_cint_u128) t[1] << 64 | t[0]; // it's lower than 2n, so t[2] is zero
+	return res < n ? res : res - n;
+}
+
+static int h_cint_strong_test_u128(const h_cint_u128 n, const uint64_t base) {
+	// a Miller-Rabin round using the native Montgomery arithmetic, n is odd.
+	const uint64_t n_inv = -h_cint_mont_inverse((uint64_t) n);
+	h_cint_u128 one = ((h_cint_u128) 1 << 64) % n, r2, d = n - 1, x, b;
+	int i, s = 0;
+	if (base % n == 0) return 1;
+	for (i = 0; i < 64; ++i) one = one << 1 >= n ? (one << 1) - n : one << 1; // 2^128 mod n
+	for (r2 = one, i = 0; i < 128; ++i) r2 = r2 << 1 >= n ? (r2 << 1) - n : r2 << 1; // 2^256 mod n
+	const h_cint_u128 minus_one = n - one;
+	b = h_cint_mont_mul_u128(base % n, r2, n, n_inv), x = one;
+	for (; !(d & 1); d >>= 1, ++s);
+	for (; d; d >>= 1, b = h_cint_mont_mul_u128(b, b, n, n_inv))
+		if (d & 1) x = h_cint_mont_mul_u128(x, b, n, n_inv);
+	if (x == one || x == minus_one) return 1;
+	while (--s > 0)
+		if ((x = h_cint_mont_mul_u128(x, x, n, n_inv)) == minus_one) return 1;
+	return 0;
+}
+
+static int h_cint_is_prime_native(const cint *N) {
+	// deterministic Miller-Rabin of an odd N below 2^81 using fixed witness sets, without any cint temporary.
+	// Jim Sinclair's 7 bases are exact below 2^64, the 13 first primes are exact below 3.3 * 10^24 > 2^81.
+	static const uint64_t bases_64[] = {2, 325, 9375, 28178, 450775, 9780504, 1795265022};
+	static const uint64_t bases_81[] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41};
+	h_cint_u128 n = 0;
+	int res = 1;
+	for (const h_cint_t *p = N->end; --p >= N->mem; n = n << cint_exponent | (uint64_t) *p);
+	if (n >> 64 == 0)
+		for (size_t i = 0; res && i < sizeof(bases_64) / sizeof(*bases_64); ++i)
+			res = h_cint_strong_test_u64((uint64_t) n, bases_64[i]);
+	else
+		for (size_t i = 0; res && i < sizeof(bases_81) / sizeof(*bases_81); ++i)
+			res = h_cint_strong_test_u128(n, bases_81[i]);
+	return res;
+}
+
+#endif
+
+static int h_cint_miller_rabin(cint_sheet *sheet, const cint *N, int iterations, uint64_t *seed) {
+	// the Miller-Rabin rounds with random bases, for an odd N that passed the presieve.
+	int res = 1;
+	size_t a, bits = cint_count_bits(N), rand_mod = bits - 3;
+#ifdef __SIZEOF_INT128__
+	if (bits <= 81)
+		return h_cint_is_prime_native(N); // the answer is exact, whatever the number of iterations.
+#endif
+	cint *A = h_cint_tmp(sheet, 5, N),
+			*B = h_cint_tmp(sheet, 6, N),
+			*C = h_cint_tmp(sheet, 7, N);
+	if (iterations <= 0)
+		// decides the number of Miller-Rabin iterations for the caller ...
+		iterations = bits < 150 ? 24 : bits < 200 ? 18 : bits < 250 ? 16 : bits < 300 ? 13 : bits < 350 ? 10 : bits < 400 ? 9 : bits < 450 ? 8 : bits < 550 ? 7 : bits < 650 ? 6 : bits < 850 ? 5 : bits < 1300 ? 4 : 3;
+	cint_dup(A, N);
+	cint_erase(B), *B->end++ = 1;
+	cint_subi(A, B);
+	cint_dup(C, A); // C = (N - 1)
+	cint_right_shifti(C, a = cint_count_zeros(C)); // divides C by 2 until C is odd
+	for (bits = 2; iterations-- && res;) {
+		cint_random_bits(B, bits, seed); // take a number
+		bits = 3 + *B->mem % rand_mod;
+		res = h_cint_strong_test(sheet, N, A, C, a, B);
+	}
+	return res;
+}
+
+int cint_is_prime(cint_sheet *sheet, const cint *N, int iterations, uint64_t *seed) {
+	// is N is considered as a prime number ? the function returns 0 or 1.
+	// when the number of Miller-Rabin iterations is zero, it's automatic.
+	H_CINT_BEGIN(sheet, CINT_STAT_IS_PRIME, N);
+	int res = h_cint_is_prime_easy(N);
+	if (res < 0)
+		res = h_cint_miller_rabin(sheet, N, iterations, seed);
+	H_CINT_END(sheet, CINT_STAT_IS_PRIME);
+	return res;
+}
+
+static void h_cint_prime_at_least(cint_sheet *sheet, cint *num, uint64_t *seed) {
+	// replace a positive number by the smallest prime greater than or equal to it.
+	// a window of odd candidates is sieved by the small primes, whose residues follow the window.
+	if (num->end == num->mem + 1 && *num->mem <= 2)
+		cint_reinit(num, 2);
+	else
+		*num->mem |= 1;
+	if (cint_count_bits(num) <= 20)
+		for (; !cint_is_prime(sheet, num, 0, seed); h_cint_addi_u64(num, 2));
+	else {
+		enum { n_primes = sizeof(cint_small_primes) / sizeof(*cint_small_primes), width = 2048 };
+		uint32_t rem[n_primes];
+		unsigned char composite[width];
+		for (size_t i = 0, j; i < n_primes;) {
+			uint64_t m = 1, r;
+			for (j = i; j < n_primes && m * cint_small_primes[j] < 1ULL << 32; m *= cint_small_primes[j++]);
+			for (r = h_cint_mod_word(num, m); i < j; ++i)
+				rem[i] = (uint32_t) (r % cint_small_primes[i]);
+		}
+		for (;;) {
+			memset(composite, 0, sizeof(composite));
+			for (size_t i = 0; i < n_primes; ++i) {
+				const uint32_t p = cint_small_primes[i]; // num + 2k is a multiple of p when 2k = -rem (mod p).
+				for (uint32_t k = (p - rem[i]) % p * ((p + 1) >> 1) % p; k < width; k += p)
+					composite[k] = 1;
+				rem[i] = (rem[i] + 2 * width) % p;
+			}
+			size_t prev = 0;
+			for (size_t k = 0; k < width; ++k)
+				if (!composite[k]) {
+					h_cint_addi_u64(num, (k - prev) << 1), prev = k;
+					if (h_cint_miller_rabin(sheet, num, 0, seed))
+						return;
+				}
+			h_cint_addi_u64(num, (width - prev) << 1);
+		}
+	}
+}
+
+__attribute__((unused)) static void cint_next_prime(cint_sheet *sheet, const cint *num, cint *res, uint64_t *seed) {
+	// the smallest prime number greater than "num" (no verification about available memory).
+	if (num->nat < 0 || num->mem == num->end)
+		cint_reinit(res, 2);
+	else
+		cint_add_ui(num, 1, res), h_cint_prime_at_least(sheet, res, seed);
+}
+
+__attribute__((unused)) static void cint_random_prime(cint_sheet *sheet, cint *res, const size_t bits, uint64_t *seed) {
+	// provide a random prime number having exactly the requested number of bits (at least 2).
+	assert(bits >= 2);
+	do cint_random_bits(res, bits, seed), h_cint_prime_at_least(sheet, res, seed);
+	while (cint_count_bits(res) != bits);
+}
+
+__attribute__((unused)) static int cint_is_prime_bpsw(cint_sheet *sheet, const cint *N) {
+	// the Baillie-PSW test (a Miller-Rabin round of base 2, then a strong Lucas test), the function returns 0 or 1.
+	// it has no known pseudoprime, the answer is exact below 2^64, and it only costs about three exponentiations.
+	int res = h_cint_is_prime_easy(N);
+	if (res < 0) {
 		cint *A = h_cint_tmp(sheet, 5, N),
 				*B = h_cint_tmp(sheet, 6, N),
 				*C = h_cint_tmp(sheet, 7, N);
-		size_t a, b, bits = cint_count_bits(N), rand_mod = bits - 3;
-		if (iterations <= 0)
-			// decides the number of Miller-Rabin iterations for the caller ...
-			iterations = bits < 150 ? 24 : bits < 200 ? 18 : bits < 250 ? 16 : bits < 300 ? 13 : bits < 350 ? 10 : bits < 400 ? 9 : bits < 450 ? 8 : bits < 550 ? 7 : bits < 650 ? 6 : bits < 850 ? 5 : bits < 1300 ? 4 : 3;
+		size_t a;
 		cint_dup(A, N);
 		cint_erase(B), *B->end++ = 1;
 		cint_subi(A, B);
 		cint_dup(C, A); // C = (N - 1)
-		cint_right_shifti(C, a = cint_count_zeros(C)); // divides C by 2 until C is odd
-		for (bits = 2; iterations-- && res;) {
-			cint_random_bits(B, bits, seed); // take a number
-			bits = 3 + *B->mem % rand_mod;
-			cint_pow_modi(sheet, B, C, N); // raise to the power C mod N
-			if (*B->mem != 1 || B->end != B->mem + 1) {
-				for (b = a; b-- && (res = h_cint_compare(A, B));)
-					cint_mul_modi(sheet, B, B, N);
-				res = !res;
-			} // only a prime number can hold (res = 1) forever
+		cint_right_shifti(C, a = cint_count_zeros(C));
+		*B->mem = 2;
+		res = h_cint_strong_test(sheet, N, A, C, a, B) && h_cint_strong_lucas(sheet, N);
+	}
+	return res;
+}
+
+__attribute__((unused)) static int cint_jacobi(cint_sheet *sheet, const cint *a, const cint *n) {
+	// the Jacobi symbol (a/n) of an odd positive n, by the binary algorithm (shifts and subtractions, without division),
+	// it ends natively when the numbers fit a machine word. it's the Legendre symbol when n is prime.
+	assert(n->nat > 0 && n->mem != n->end && *n->mem & 1);
+	int res = a->nat < 0 && (*n->mem & 3) == 3 ? -1 : 1;
+	if (n->end <= n->mem + 2)
+		return res * h_cint_jacobi_u64(h_cint_mod_word(a, h_cint_to_u64(n)), h_cint_to_u64(n));
+	cint *x = h_cint_tmp(sheet, 2, h_cint_compare(a, n) > 0 ? a : n), *y = h_cint_tmp(sheet, 3, h_cint_compare(a, n) > 0 ? a : n), *tmp;
+	cint_dup(x, a), cint_dup(y, n), x->nat = 1;
+	while (x->mem != x->end) {
+		if (x->end <= x->mem + 2 && y->end <= y->mem + 2)
+			return res * h_cint_jacobi_u64(h_cint_to_u64(x), h_cint_to_u64(y));
+		const size_t zeros = cint_count_zeros(x);
+		cint_right_shifti(x, zeros);
+		if (zeros & 1 && ((*y->mem & 7) == 3 || (*y->mem & 7) == 5)) res = -res;
+		if (h_cint_compare(x, y) < 0) {
+			tmp = x, x = y, y = tmp; // the quadratic reciprocity
+			if ((*x->mem & 3) == 3 && (*y->mem & 3) == 3) res = -res;
 		}
+		h_cint_subi(x, y);
 	}
+	return y->end == y->mem + 1 && *y->mem == 1 ? res : 0;
+}
+
+static inline uint64_t h_cint_nonresidue_bound(const size_t bits) {
+	// under the GRH, the least quadratic non-residue of a prime p is below 2 * ln(p) ** 2, the searches stop there.
+	// a composite p can have none (a perfect square), so a longer search means that p isn't prime.
+	return 2 * (uint64_t) bits * bits + 8;
+}
+
+#ifdef __SIZEOF_INT128__
+
+static inline uint64_t h_cint_mul_mod_u64(const uint64_t a, const uint64_t b, const uint64_t m) { return (uint64_t) ((h_cint_u128) a * b % m); }
+
+static uint64_t h_cint_pow_u64(uint64_t b, uint64_t e, const uint64_t m) {
+	uint64_t res = 1 % m;
+	for (; e; e >>= 1, b = h_cint_mul_mod_u64(b, b, m))
+		if (e & 1) res = h_cint_mul_mod_u64(res, b, m);
 	return res;
 }
 
+static inline uint64_t h_cint_add_mod_u64(const uint64_t a, const uint64_t b, const uint64_t m) { return a >= m - b ? a - (m - b) : a + b; }
+
+static int h_cint_cipolla_u64(const uint64_t a, const uint64_t p, const uint64_t bound, uint64_t *res) {
+	// the native Cipolla algorithm, (w + X) ** ((p + 1) / 2) in F_p[X] / (X² - d), where d = w² - a isn't a residue.
+	uint64_t w = 1, d, u, v = 1, t;
+	for (int j; (d = h_cint_add_mod_u64(h_cint_mul_mod_u64(w, w, p), p - a, p)) != 0; ++w)
+		if ((j = h_cint_jacobi_u64(d, p)) == -1) break;
+		else if (j == 0 || w >= p || w > bound) return 0; // p isn't prime
+	if (d == 0) return *res = w, 1;
+	const uint64_t e = (p >> 1) + 1;
+	int i = 63;
+	for (u = w; !(e >> i & 1); --i);
+	while (i--) {
+		// (u + vX)² = (u² + v²d) + 2uvX
+		t = h_cint_mul_mod_u64(u, v, p);
+		u = h_cint_add_mod_u64(h_cint_mul_mod_u64(u, u, p), h_cint_mul_mod_u64(h_cint_mul_mod_u64(v, v, p), d, p), p);
+		v = h_cint_add_mod_u64(t, t, p);
+		if (e >> i & 1) {
+			// (u + vX)(w + X) = (uw + vd) + (u + vw)X
+			t = h_cint_add_mod_u64(h_cint_mul_mod_u64(u, w, p), h_cint_mul_mod_u64(v, d, p), p);
+			v = h_cint_add_mod_u64(u, h_cint_mul_mod_u64(v, w, p), p), u = t;
+		}
+	}
+	return *res = u, 1;
+}
+
+static int h_cint_sqrt_mod_u64(const uint64_t a, const uint64_t p, uint64_t *res) {
+	// the native Tonelli-Shanks algorithm, or Cipolla with the same rule as the numbers, a < p and p is an odd prime.
+	if (a == 0) return *res = 0, 1;
+	if (h_cint_jacobi_u64(a, p) != 1) return 0;
+	uint64_t q = p - 1, z = 2;
+	int s = 0, i, bits = 0, j;
+	for (; !(q & 1); q >>= 1, ++s);
+	for (; p >> bits; ++bits);
+	const uint64_t bound = h_cint_nonresidue_bound(bits);
+	if (s * (s - 1) > 8 * bits + 20)
+		return h_cint_cipolla_u64(a, p, bound, res);
+	for (; (j = h_cint_jacobi_u64(z, p)) != -1; ++z)
+		if (j == 0 || z >= p || z > bound) return 0; // p isn't prime
+	uint64_t c = h_cint_pow_u64(z, q, p), x = h_cint_pow_u64(a, (q + 1) >> 1, p), t = h_cint_pow_u64(a, q, p);
+	for (int m = s; t != 1; m = i) {
+		uint64_t t2 = t, b = c;
+		for (i = 0; t2 != 1 && i < m; ++i) t2 = h_cint_mul_mod_u64(t2, t2, p);
+		if (i == m) return 0; // p isn't prime
+		for (int j = 0; j < m - i - 1; ++j) b = h_cint_mul_mod_u64(b, b, p);
+		x = h_cint_mul_mod_u64(x, b, p), c = h_cint_mul_mod_u64(b, b, p), t = h_cint_mul_mod_u64(t, c, p);
+	}
+	return *res = x, 1;
+}
+
+#endif
+
+static int h_cint_tonelli_shanks(cint_sheet *sheet, const cint *A, const cint *p, const size_t s, cint *res) {
+	// the square root of a quadratic residue A of [1, p), where p - 1 = Q * 2 ** s.
+	cint *Q = h_cint_tmp(sheet, 6, p), *c = h_cint_tmp(sheet, 7, p), *t = h_cint_tmp(sheet, 8, p), *x = h_cint_tmp(sheet, 9, p), *b;
+	long long z = 2;
+	const uint64_t bound = h_cint_nonresidue_bound(cint_count_bits(p));
+	for (int j; (j = h_cint_jacobi_word(z, p)) != -1; ++z)
+		if (j == 0 || (uint64_t) z > bound) return 0; // p isn't prime
+	cint_dup(Q, p), cint_right_shifti(Q, s);
+	cint_reinit(c, z), cint_pow_modi(sheet, c, Q, p);
+	cint_dup(t, A), cint_pow_modi(sheet, t, Q, p);
+	h_cint_addi_u64(Q, 1), cint_right_shifti(Q, 1);
+	cint_dup(x, A), cint_pow_modi(sheet, x, Q, p);
+	for (size_t m = s, i; t->end != t->mem + 1 || *t->mem != 1; m = i) {
+		// find the least i such that t ** (2 ** i) = 1, then b = c ** (2 ** (m - i - 1)).
+		b = h_cint_tmp(sheet, 5, p), cint_dup(b, t);
+		for (i = 0; (b->end != b->mem + 1 || *b->mem != 1) && i < m; ++i) cint_mul_modi(sheet, b, b, p);
+		if (i == m) return 0; // p isn't prime
+		b = Q, cint_dup(b, c);
+		for (size_t j = 0; j + i + 1 < m; ++j) cint_mul_modi(sheet, b, b, p);
+		cint_mul_modi(sheet, x, b, p), cint_dup(c, b), cint_mul_modi(sheet, c, b, p), cint_mul_modi(sheet, t, c, p);
+	}
+	return cint_dup(res, x), 1;
+}
+
+static int h_cint_cipolla(cint_sheet *sheet, const cint *A, const cint *p, cint *res) {
+	// the square root of a quadratic residue A of [1, p), computed as (w + X) ** ((p + 1) / 2) in F_p[X] / (X² - d),
+	// where d = w² - A isn't a quadratic residue. it's preferred when p - 1 is divisible by a large power of 2.
+	cint *d = h_cint_tmp(sheet, 5, p), *e = h_cint_tmp(sheet, 6, p), *u = h_cint_tmp(sheet, 7, p), *v = h_cint_tmp(sheet, 8, p), *t = h_cint_tmp(sheet, 9, p);
+	uint64_t w = 1;
+	const uint64_t bound = h_cint_nonresidue_bound(cint_count_bits(p));
+	for (int j; h_cint_reinit_u64(d, w * w), cint_subi(d, A), h_cint_mod_positive(p, d), d->mem != d->end; ++w)
+		if ((j = cint_jacobi(sheet, d, p)) == -1) break;
+		else if (j == 0 || w > bound) return 0; // p isn't prime
+	if (d->mem == d->end) return h_cint_reinit_u64(res, w), 1;
+	cint_dup(e, p), h_cint_addi_u64(e, 1), cint_right_shifti(e, 1);
+	h_cint_reinit_u64(u, w), cint_reinit(v, 1);
+	for (size_t i = cint_count_bits(e) - 1; i--;) {
+		// (u + vX)² = (u² + v²d) + 2uvX
+		cint_dup(t, u), cint_mul_modi(sheet, t, v, p);
+		cint_mul_modi(sheet, u, u, p), cint_mul_modi(sheet, v, v, p), cint_mul_modi(sheet, v, d, p);
+		cint_addi(u, v), h_cint_mod_positive(p, u);
+		cint_dup(v, t), cint_left_shifti(v, 1), h_cint_mod_positive(p, v);
+		if (e->mem[i / cint_exponent] >> i % cint_exponent & 1) {
+			// (u + vX)(w + X) = (uw + vd) + (u + vw)X
+			cint_dup(t, v), cint_mul_modi(sheet, t, d, p);
+			cint_muli_ui(v, w), cint_addi(v, u), h_cint_mod_positive(p, v);
+			cint_muli_ui(u, w), cint_addi(u, t), h_cint_mod_positive(p, u);
+		}
+	}
+	return cint_dup(res, u), 1;
+}
+
+__attribute__((unused)) static int cint_sqrt_mod(cint_sheet *sheet, const cint *a, const cint *p, cint *res) {
+	// a square root of "a" modulo a prime p, the function returns 1 and the smaller root (the other one is p - res),
+	// or it returns 0 when "a" isn't a quadratic residue (or when p is found composite). Tonelli-Shanks is used, or
+	// Cipolla when p - 1 has many factors 2, both natively when p fits two words.
+	int found = 1;
+	assert(p->nat > 0 && p->mem != p->end);
+	if (!(*p->mem & 1)) {
+		assert(p->end == p->mem + 1 && *p->mem == 2); // the only even prime
+		return h_cint_reinit_u64(res, cint_mod_ui(a, 2)), 1;
+	}
+#ifdef __SIZEOF_INT128__
+	if (p->end <= p->mem + 2) {
+		uint64_t r;
+		const uint64_t n = h_cint_to_u64(p);
+		cint_erase(res);
+		if ((found = h_cint_sqrt_mod_u64(cint_mod_ui(a, n), n, &r)))
+			h_cint_reinit_u64(res, r < n - r ? r : n - r);
+		return found;
+	}
+#endif
+	// the residue of "a" is kept into "res" until the root replaces it.
+	cint *q = h_cint_tmp(sheet, 3, a), *r = h_cint_tmp(sheet, 4, a), *A = res;
+	cint_div(sheet, a, p, q, r), h_cint_mod_positive(p, r), cint_dup(A, r);
+	if (A->mem == A->end) return 1;
+	if (cint_jacobi(sheet, A, p) != 1) return cint_erase(res), 0;
+	size_t s = 1; // p - 1 = Q * 2 ** s
+	for (; !(p->mem[s / cint_exponent] >> s % cint_exponent & 1); ++s);
+	if (s == 1) {
+		// p = 3 mod 4, the root is A ** ((p + 1) / 4).
+		cint *e = h_cint_tmp(sheet, 5, p), *x = h_cint_tmp(sheet, 6, p);
+		cint_dup(e, p), h_cint_addi_u64(e, 1), cint_right_shifti(e, 2);
+		cint_dup(x, A), cint_pow_modi(sheet, x, e, p), cint_dup(res, x);
+	} else if (s * (s - 1) > 8 * cint_count_bits(p) + 20)
+		found = h_cint_cipolla(sheet, A, p, res);
+	else
+		found = h_cint_tonelli_shanks(sheet, A, p, s, res);
+	if (found) {
+		cint *other = h_cint_tmp(sheet, 5, p);
+		cint_dup(other, p), h_cint_subi(other, res);
+		if (h_cint_compare(other, res) < 0) cint_dup(res, other);
+	} else cint_erase(res);
+	return found;
+}
+
+// The sheet of the calling thread is created on first use, its temporaries grow to the largest operands met, then
+// it's reused by the "_auto" functions without allocation. It's freed by "cint_release_thread_sheet" (and by itself
+// when the thread terminates, in the parallel mode). Every computing function taking a sheet has its "_auto" variant,
+// the functions of the sheet itself (clear, statistics and hooks) have none.
+
+#ifndef CINT_THREAD_SHEET_BITS
+#define CINT_THREAD_SHEET_BITS 1024
+#endif
+
+#if defined(__cplusplus) && __cplusplus >= 201103L
+#define H_CINT_THREAD_LOCAL thread_local
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define H_CINT_THREAD_LOCAL _Thread_local
+#else
+#define H_CINT_THREAD_LOCAL __thread // before C11, the storage class of GCC and Clang.
+#endif
+
+static H_CINT_THREAD_LOCAL cint_sheet *h_cint_thread_sheet;
+
+#ifdef CINT_THREADS
+static pthread_key_t h_cint_thread_sheet_key;
+static pthread_once_t h_cint_thread_sheet_once = PTHREAD_ONCE_INIT;
+
+static void h_cint_thread_sheet_exit(void *sheet) {
+	cint_clear_sheet((cint_sheet *) sheet);
+	h_cint_thread_sheet = 0;
+}
+
+static void h_cint_thread_sheet_key_init(void) {
+	const int err = pthread_key_create(&h_cint_thread_sheet_key, h_cint_thread_sheet_exit);
+	assert(!err), (void) err;
+}
+#endif
+
+static inline cint_sheet *cint_thread_sheet(void) {
+	if (!h_cint_thread_sheet) {
+		h_cint_thread_sheet = cint_new_sheet(CINT_THREAD_SHEET_BITS);
+#ifdef CINT_THREADS
+		pthread_once(&h_cint_thread_sheet_once, h_cint_thread_sheet_key_init);
+		pthread_setspecific(h_cint_thread_sheet_key, h_cint_thread_sheet);
+#endif
+	}
+	return h_cint_thread_sheet;
+}
+
+__attribute__((unused)) static void cint_release_thread_sheet(void) {
+	if (h_cint_thread_sheet) {
+#ifdef CINT_THREADS
+		pthread_setspecific(h_cint_thread_sheet_key, 0);
+#endif
+		cint_clear_sheet(h_cint_thread_sheet);
+		h_cint_thread_sheet = 0;
+	}
+}
+
+__attribute__((unused)) static inline void cint_powi_auto(cint *n, const cint *exp) { cint_powi(cint_thread_sheet(), n, exp); }
+
+__attribute__((unused)) static inline void cint_pow_auto(const cint *n, const cint *exp, cint *res) { cint_pow(cint_thread_sheet(), n, exp, res); }
+
+__attribute__((unused)) static inline void cint_div_auto(const cint *lhs, const cint *rhs, cint *q, cint *r) { cint_div(cint_thread_sheet(), lhs, rhs, q, r); }
+
+__attribute__((unused)) static inline void cint_divexact_auto(const cint *lhs, const cint *rhs, cint *q) { cint_divexact(cint_thread_sheet(), lhs, rhs, q); }
+
+__attribute__((unused)) static inline int cint_is_divisible_auto(const cint *num, const cint *div) { return cint_is_divisible(cint_thread_sheet(), num, div); }
+
+__attribute__((unused)) static inline char *cint_to_string_alt_auto(const cint *num, const int base) { return cint_to_string_alt(cint_thread_sheet(), num, base); }
+
+__attribute__((unused)) static inline char *cint_to_string_buffer_alt_auto(const cint *num, char *buf, const int base) { return cint_to_string_buffer_alt(cint_thread_sheet(), num, buf, base); }
+
+__attribute__((unused)) static inline void cint_write_stream_auto(const cint *num, const int base, void (*emit)(const char *chunk, size_t len, void *data), void *data) { cint_write_stream(cint_thread_sheet(), num, base, emit, data); }
+
+__attribute__((unused)) static inline void cint_write_file_auto(const cint *num, const int base, FILE *out) { cint_write_file(cint_thread_sheet(), num, base, out); }
+
+__attribute__((unused)) static inline void cint_factorial_auto(const unsigned n, cint *res) { cint_factorial(cint_thread_sheet(), n, res); }
+
+__attribute__((unused)) static inline void cint_mul_mod_auto(const cint *lhs, const cint *rhs, const cint *mod, cint *res) { cint_mul_mod(cint_thread_sheet(), lhs, rhs, mod, res); }
+
+__attribute__((unused)) static inline void cint_mul_modi_auto(cint *lhs, const cint *rhs, const cint *mod) { cint_mul_modi(cint_thread_sheet(), lhs, rhs, mod); }
+
+__attribute__((unused)) static inline void cint_pow_modi_auto(cint *n, const cint *exp, const cint *mod) { cint_pow_modi(cint_thread_sheet(), n, exp, mod); }
+
+__attribute__((unused)) static inline void cint_pow_mod_auto(const cint *n, const cint *exp, const cint *mod, cint *res) { cint_pow_mod(cint_thread_sheet(), n, exp, mod, res); }
+
+__attribute__((unused)) static inline void cint_mul_mod_batch_auto(const cint *lhs, const cint *rhs, const cint *mod, cint *res, const size_t n) { cint_mul_mod_batch(cint_thread_sheet(), lhs, rhs, mod, res, n); }
+
+__attribute__((unused)) static inline void cint_pow_mod_batch_auto(const cint *bases, const cint *exps, const cint *mod, cint *res, const size_t n) { cint_pow_mod_batch(cint_thread_sheet(), bases, exps, mod, res, n); }
+
+__attribute__((unused)) static inline void cint_multi_pow_mod_auto(const cint *bases, const cint *exps, const size_t k, const cint *mod, cint *res) { cint_multi_pow_mod(cint_thread_sheet(), bases, exps, k, mod, res); }
+
+__attribute__((unused)) static inline void cint_gcd_auto(const cint *lhs, const cint *rhs, cint *gcd) { cint_gcd(cint_thread_sheet(), lhs, rhs, gcd); }
+
+__attribute__((unused)) static inline void cint_binary_gcd_auto(const cint *lhs, const cint *rhs, cint *gcd) { cint_binary_gcd(cint_thread_sheet(), lhs, rhs, gcd); }
+
+__attribute__((unused)) static inline cint_crt *cint_crt_build_auto(const cint *moduli, const size_t n) { return cint_crt_build(cint_thread_sheet(), moduli, n); }
+
+__attribute__((unused)) static inline void cint_crt_reduce_auto(cint_crt *crt, const cint *num, cint *res) { cint_crt_reduce(cint_thread_sheet(), crt, num, res); }
+
+__attribute__((unused)) static inline void cint_crt_combine_auto(cint_crt *crt, const cint *residues, cint *res) { cint_crt_combine(cint_thread_sheet(), crt, residues, res); }
+
+__attribute__((unused)) static inline unsigned cint_remove_auto(cint *N, const cint *F) { return cint_remove(cint_thread_sheet(), N, F); }
+
+__attribute__((unused)) static inline void cint_sqrt_auto(const cint *num, cint *res, cint *rem) { cint_sqrt(cint_thread_sheet(), num, res, rem); }
+
+__attribute__((unused)) static inline void cint_cbrt_auto(const cint *num, cint *res, cint *rem) { cint_cbrt(cint_thread_sheet(), num, res, rem); }
+
+__attribute__((unused)) static inline void cint_nth_root_auto(const cint *num, const unsigned nth, cint *res) { cint_nth_root(cint_thread_sheet(), num, nth, res); }
+
+__attribute__((unused)) static inline void cint_nth_root_remainder_auto(const cint *num, const unsigned nth, cint *res, cint *rem) { cint_nth_root_remainder(cint_thread_sheet(), num, nth, res, rem); }
+
+__attribute__((unused)) static inline void cint_modular_inverse_auto(const cint *lhs, const cint *rhs, cint *res) { cint_modular_inverse(cint_thread_sheet(), lhs, rhs, res); }
+
+__attribute__((unused)) static inline int cint_jacobi_auto(const cint *a, const cint *n) { return cint_jacobi(cint_thread_sheet(), a, n); }
+
+__attribute__((unused)) static inline int cint_sqrt_mod_auto(const cint *a, const cint *p, cint *res) { return cint_sqrt_mod(cint_thread_sheet(), a, p, res); }
+
+__attribute__((unused)) static inline int cint_is_prime_auto(const cint *N, const int iterations, uint64_t *seed) { return cint_is_prime(cint_thread_sheet(), N, iterations, seed); }
+
+__attribute__((unused)) static inline void cint_next_prime_auto(const cint *num, cint *res, uint64_t *seed) { cint_next_prime(cint_thread_sheet(), num, res, seed); }
+
+__attribute__((unused)) static inline void cint_random_prime_auto(cint *res, const size_t bits, uint64_t *seed) { cint_random_prime(cint_thread_sheet(), res, bits, seed); }
+
+__attribute__((unused)) static inline int cint_is_prime_bpsw_auto(const cint *N) { return cint_is_prime_bpsw(cint_thread_sheet(), N); }
+
+// Fixed-width integers, the macro CINT_FIXED(BITS) generates the type cint<BITS> (a multiple of 32 bits) whose value
+// is an array of 32-bit words, on the stack, without sign, and taken modulo 2^BITS. The word count of the functions
+// is known at compile time, so the inlined loops are unrolled by the compiler.
+
+static inline uint32_t h_cint_fixed_add(uint32_t *res, const uint32_t *a, const uint32_t *b, const size_t n) {
+	uint64_t c = 0;
+	for (size_t i = 0; i < n; ++i)
+		c += (uint64_t) a[i] + b[i], res[i] = (uint32_t) c, c >>= 32;
+	return (uint32_t) c;
+}
+
+static inline uint32_t h_cint_fixed_sub(uint32_t *res, const uint32_t *a, const uint32_t *b, const size_t n) {
+	uint64_t c = 0;
+	for (size_t i = 0; i < n; ++i)
+		c = (uint64_t) a[i] - b[i] - c, res[i] = (uint32_t) c, c >>= 63;
+	return (uint32_t) c;
+}
+
+static inline void h_cint_fixed_mul(uint32_t *res, const uint32_t *a, const uint32_t *b, const size_t n, const size_t n_res) {
+	// the "n_res" lowest words of the product, "res" can't overlap the operands.
+	memset(res, 0, n_res * sizeof(*res));
+	for (size_t i = 0; i < n; ++i) {
+		uint64_t c = 0;
+		for (size_t j = 0; j < n && i + j < n_res; ++j)
+			c += (uint64_t) a[i] * b[j] + res[i + j], res[i + j] = (uint32_t) c, c >>= 32;
+		if (i + n < n_res) res[i + n] = (uint32_t) c;
+	}
+}
+
+static inline int h_cint_fixed_compare(const uint32_t *a, const uint32_t *b, const size_t n) {
+	for (size_t i = n; i--;)
+		if (a[i] != b[i]) return a[i] < b[i] ? -1 : 1;
+	return 0;
+}
+
+static inline uint32_t h_cint_fixed_word(const uint32_t *v, const size_t i, const unsigned shift) {
+	// the word i of "v" shifted left by "shift" bits, the divisor is normalized without a copy.
+	return v[i] << shift | (shift && i ? v[i - 1] >> (32 - shift) : 0);
+}
+
+static void h_cint_fixed_mod(uint32_t *res, const uint32_t *u, const size_t m, const uint32_t *v, const size_t n, uint32_t *un) {
+	// the remainder of "u" (m words) by a non-zero "v" (n words) in "res" (n words), by the Knuth's algorithm D.
+	// "res" can overlap "u", the caller provides "un" of m + 1 words to hold the normalized "u".
+	size_t vn = n, um = m;
+	unsigned shift = 0;
+	while (vn && !v[vn - 1]) --vn;
+	assert(vn); // divide by zero
+	while (um && !u[um - 1]) --um;
+	if (um < vn || (um == vn && h_cint_fixed_compare(u, v, vn) < 0)) {
+		memmove(res, u, um * sizeof(*res));
+		memset(res + um, 0, (n - um) * sizeof(*res));
+		return;
+	}
+	if (vn == 1) {
+		uint64_t r = 0;
+		for (size_t i = um; i--;) r = (r << 32 | u[i]) % v[0];
+		memset(res, 0, n * sizeof(*res));
+		*res = (uint32_t) r;
+		return;
+	}
+	while (!(v[vn - 1] << shift & 0x80000000u)) ++shift;
+	const uint32_t top_v = h_cint_fixed_word(v, vn - 1, shift), next_v = h_cint_fixed_word(v, vn - 2, shift);
+	un[um] = shift ? u[um - 1] >> (32 - shift) : 0;
+	for (size_t i = um; --i;) un[i] = u[i] << shift | (shift ? u[i - 1] >> (32 - shift) : 0);
+	un[0] = u[0] << shift;
+	for (size_t j = um - vn + 1; j--;) {
+		// estimate the quotient word, then subtract its product by the divisor.
+		const uint64_t top = (uint64_t) un[j + vn] << 32 | un[j + vn - 1];
+		uint64_t q = top / top_v, r = top % top_v;
+		while (q >> 32 || q * next_v > (r << 32 | un[j + vn - 2]))
+			if (--q, (r += top_v) >> 32) break;
+		int64_t t, borrow = 0;
+		for (size_t i = 0; i < vn; ++i) {
+			const uint64_t p = q * h_cint_fixed_word(v, i, shift);
+			t = (int64_t) un[i + j] - borrow - (int64_t) (p & 0xFFFFFFFFu);
+			un[i + j] = (uint32_t) t, borrow = (int64_t) (p >> 32) - (t >> 32);
+		}
+		t = (int64_t) un[j + vn] - borrow, un[j + vn] = (uint32_t) t;
+		if (t < 0) { // the estimate was one too large, add back.
+			uint64_t c = 0;
+			for (size_t i = 0; i < vn; ++i)
+				c += (uint64_t) un[i + j] + h_cint_fixed_word(v, i, shift), un[i + j] = (uint32_t) c, c >>= 32;
+			un[j + vn] += (uint32_t) c;
+		}
+	}
+	memset(res, 0, n * sizeof(*res));
+	for (size_t i = 0; i < vn; ++i)
+		res[i] = un[i] >> shift | (shift ? un[i + 1] << (32 - shift) : 0);
+}
+
+static void h_cint_fixed_from_cint(uint32_t *res, const cint *num, const size_t n) {
+	// the value of "num" modulo 2^(32 * n), in two's complement when it's negative.
+	uint64_t acc = 0;
+	size_t bits = 0, i = 0;
+	for (const h_cint_t *p = num->mem; p < num->end && i < n; ++p)
+		for (acc |= (uint64_t) *p << bits, bits += cint_exponent; bits >= 32 && i < n; bits -= 32, acc >>= 32)
+			res[i++] = (uint32_t) acc;
+	for (; i < n; acc >>= 32, bits = 0) res[i++] = (uint32_t) acc;
+	if (num->nat < 0) {
+		uint64_t c = 1;
+		for (i = 0; i < n; ++i) c += (uint32_t) ~res[i], res[i] = (uint32_t) c, c >>= 32;
+	}
+}
+
+static void h_cint_fixed_to_cint(cint *res, const uint32_t *num, const size_t n) {
+	// "res" must be able to hold 32 * n bits.
+	uint64_t acc = 0;
+	size_t bits = 0;
+	cint_erase(res);
+	for (size_t i = 0; i < n; ++i)
+		for (acc |= (uint64_t) num[i] << bits, bits += 32; bits >= (size_t) cint_exponent; bits -= cint_exponent, acc >>= cint_exponent)
+			*res->end++ = (h_cint_t) (acc & cint_mask);
+	*res->end++ = (h_cint_t) acc;
+	while (res->end > res->mem && !*(res->end - 1)) --res->end;
+}
+
+#define CINT_FIXED(BITS) \
+	typedef struct { uint32_t w[(BITS) / 32]; } cint##BITS; \
+	__attribute__((unused)) static inline void cint##BITS##_from_cint(cint##BITS *res, const cint *num) { h_cint_fixed_from_cint(res->w, num, (BITS) / 32); } \
+	__attribute__((unused)) static inline void cint##BITS##_to_cint(cint *res, const cint##BITS *num) { h_cint_fixed_to_cint(res, num->w, (BITS) / 32); } \
+	__attribute__((unused)) static inline int cint##BITS##_compare(const cint##BITS *lhs, const cint##BITS *rhs) { return h_cint_fixed_compare(lhs->w, rhs->w, (BITS) / 32); } \
+	__attribute__((unused)) static inline uint32_t cint##BITS##_add(cint##BITS *res, const cint##BITS *lhs, const cint##BITS *rhs) { return h_cint_fixed_add(res->w, lhs->w, rhs->w, (BITS) / 32); } \
+	__attribute__((unused)) static inline uint32_t cint##BITS##_sub(cint##BITS *res, const cint##BITS *lhs, const cint##BITS *rhs) { return h_cint_fixed_sub(res->w, lhs->w, rhs->w, (BITS) / 32); } \
+	__attribute__((unused)) static inline void cint##BITS##_mul(cint##BITS *res, const cint##BITS *lhs, const cint##BITS *rhs) { \
+		cint##BITS tmp; \
+		h_cint_fixed_mul(tmp.w, lhs->w, rhs->w, (BITS) / 32, (BITS) / 32), *res = tmp; \
+	} \
+	__attribute__((unused)) static inline void cint##BITS##_mod(cint##BITS *res, const cint##BITS *num, const cint##BITS *mod) { \
+		uint32_t work[(BITS) / 16 + 1]; \
+		h_cint_fixed_mod(res->w, num->w, (BITS) / 32, mod->w, (BITS) / 32, work); \
+	} \
+	__attribute__((unused)) static inline void cint##BITS##_mul_mod(cint##BITS *res, const cint##BITS *lhs, const cint##BITS *rhs, const cint##BITS *mod) { \
+		uint32_t tmp[(BITS) / 16], work[(BITS) / 16 + 1]; \
+		h_cint_fixed_mul(tmp, lhs->w, rhs->w, (BITS) / 32, (BITS) / 16), h_cint_fixed_mod(res->w, tmp, (BITS) / 16, mod->w, (BITS) / 32, work); \
+	} \
+	__attribute__((unused)) static void cint##BITS##_pow_mod(cint##BITS *res, const cint##BITS *base, const cint##BITS *exp, const cint##BITS *mod) { \
+		cint##BITS b, r = {{1}}; \
+		size_t i = (BITS); \
+		cint##BITS##_mod(&b, base, mod), cint##BITS##_mod(&r, &r, mod); \
+		while (i && !(exp->w[(i - 1) / 32] >> (i - 1) % 32 & 1)) --i; \
+		while (i--) { \
+			cint##BITS##_mul_mod(&r, &r, &r, mod); \
+			if (exp->w[i / 32] >> i % 32 & 1) cint##BITS##_mul_mod(&r, &r, &b, mod); \
+		} \
+		*res = r; \
+	}
+
+CINT_FIXED(128)
+CINT_FIXED(256)
+CINT_FIXED(512)
+CINT_FIXED(1024)
+CINT_FIXED(2048)
+CINT_FIXED(4096)
+
 #endif
@@ -0,0 +1,305 @@
+#ifndef CINT_HPP
+#define CINT_HPP
+
+// A header-only C++ wrapper of the tiny Big Integer Library (C++11 or later).
+// - the numbers release their memory by themselves (RAII), and they are moved without copy.
+// - every thread owns a sheet and a few scratch numbers, they keep their memory between the calls.
+// - the arithmetic operators build expression templates, so "a = b * c + d" is computed in place by "cint_mul"
+//   then "cint_addi" into the memory of "a", without temporary allocation once the memory has grown.
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include "big-num.c"
+
+namespace cint_cpp {
+
+	class integer;
+
+	namespace detail {
+		enum class op { add, sub, mul, div, mod };
+
+		template<op O, class L, class R>
+		struct expr;
+
+		template<class T>
+		struct is_expr : std::false_type {};
+
+		template<op O, class L, class R>
+		struct is_expr<expr<O, L, R>> : std::true_type {};
+
+		template<class T>
+		struct is_operand : std::integral_constant<bool, std::is_same<T, integer>::value || is_expr<T>::value> {};
+
+		// the numbers are held by reference, the nested expressions by value.
+		template<class T>
+		using stored = typename std::conditional<is_expr<T>::value, const T, const T &>::type;
+
+		inline cint_sheet *sheet();
+
+		inline integer &scratch(size_t depth);
+
+		inline const cint *value(const integer &num, size_t depth);
+
+		template<op O, class L, class R>
+		inline const cint *value(const expr<O, L, R> &e, size_t depth);
+	}
+
+	class integer {
+		cint num;
+
+		template<detail::op O, class L, class R> friend
+		struct detail::expr;
+
+		void assign(const cint *from) {
+			if (from != &num) reserve(from->end - from->mem + 1), cint_dup(&num, from);
+		}
+
+	public:
+		integer(const long long int val = 0) { cint_init(&num, 64, val); }
+
+		explicit integer(const char *str, const int base = 10) {
+			cint_init(&num, cint_approx_bits_from_digits(strlen(str), base), 0), cint_reinit_by_string(&num, str, base);
+		}
+
+		explicit integer(const std::string &str, const int base = 10) : integer(str.c_str(), base) {}
+
+		explicit integer(const cint *from) {
+			cint_init(&num, cint_count_bits(from), 0), assign(from);
+		}
+
+		integer(const integer &other) : integer(&other.num) {}
+
+		integer(integer &&other) noexcept : num(other.num) {
+			other.num.mem = other.num.end = nullptr, other.num.size = 0, other.num.nat = 1;
+		}
+
+		template<class E, class = typename std::enable_if<detail::is_expr<E>::value>::type>
+		integer(const E &e) : integer() { *this = e; }
+
+		~integer() { free(num.mem); }
+
+		integer &operator=(const integer &other) { return assign(&other.num), *this; }
+
+		integer &operator=(integer &&other) noexcept { return swap(other), *this; }
+
+		template<class E>
+		typename std::enable_if<detail::is_expr<E>::value, integer &>::type operator=(const E &e) {
+			if (e.refers(this)) {
+				// the result can't be written where the operands are read.
+				integer &res = detail::scratch(0);
+				e.eval(res, 1), swap(res);
+			} else e.eval(*this, 0);
+			return *this;
+		}
+
+		void swap(integer &other) noexcept { std::swap(num, other.num); }
+
+		// ensure the memory to hold "words" words of 31 bits, the value is kept.
+		void reserve(const size_t words) {
+			if (num.size <= words) cint_rescale(&num, words * cint_exponent);
+		}
+
+		cint *get() { return &num; }
+
+		const cint *get() const { return &num; }
+
+		size_t bits() const { return cint_count_bits(&num); }
+
+		int sign() const { return num.mem == num.end ? 0 : (int) num.nat; }
+
+		std::string str(const int base = 10) const {
+			char *s = cint_to_string(&num, base);
+			std::string res(s);
+			free(s);
+			return res;
+		}
+
+		integer &negate() { return cint_negate(&num), *this; }
+
+		template<class E>
+		typename std::enable_if<detail::is_operand<E>::value, integer &>::type operator+=(const E &e) {
+			const cint *v = detail::value(e, 1);
+			reserve(std::max(num.end - num.mem, v->end - v->mem) + 2);
+			if (v == &num) return cint_left_shifti(&num, 1), *this;
+			cint_addi(&num, v);
+			return *this;
+		}
+
+		template<class E>
+		typename std::enable_if<detail::is_operand<E>::value, integer &>::type operator-=(const E &e) {
+			const cint *v = detail::value(e, 1);
+			if (v == &num) return cint_erase(&num), *this;
+			reserve(std::max(num.end - num.mem, v->end - v->mem) + 2), cint_subi(&num, v);
+			return *this;
+		}
+
+		template<class E>
+		typename std::enable_if<detail::is_operand<E>::value, integer &>::type operator*=(const E &e) { return *this = *this * e; }
+
+		template<class E>
+		typename std::enable_if<detail::is_operand<E>::value, integer &>::type operator/=(const E &e) { return *this = *this / e; }
+
+		template<class E>
+		typename std::enable_if<detail::is_operand<E>::value, integer &>::type operator%=(const E &e) { return *this = *this % e; }
+
+		integer &operator+=(const long long int val) { return reserve(num.end - num.mem + 4), cint_addi_si(&num, val), *this; }
+
+		integer &operator-=(const long long int val) { return reserve(num.end - num.mem + 4), cint_subi_si(&num, val), *this; }
+
+		integer &operator*=(const long long int val) { return reserve(num.end - num.mem + 4), cint_muli_si(&num, val), *this; }
+
+		integer &operator<<=(const size_t bits) { return reserve(num.end - num.mem + bits / cint_exponent + 2), cint_left_shifti(&num, bits), *this; }
+
+		integer &operator>>=(const size_t bits) { return cint_right_shifti(&num, bits), *this; }
+
+		friend int compare(const integer &lhs, const integer &rhs) {
+			const int res = cint_compare(&lhs.num, &rhs.num);
+			return (0 < res) - (res < 0);
+		}
+
+		friend bool operator==(const integer &lhs, const integer &rhs) { return compare(lhs, rhs) == 0; }
+
+		friend bool operator!=(const integer &lhs, const integer &rhs) { return compare(lhs, rhs) != 0; }
+
+		friend bool operator<(const integer &lhs, const integer &rhs) { return compare(lhs, rhs) < 0; }
+
+		friend bool operator>(const integer &lhs, const integer &rhs) { return compare(lhs, rhs) > 0; }
+
+		friend bool operator<=(const integer &lhs, const integer &rhs) { return compare(lhs, rhs) <= 0; }
+
+		friend bool operator>=(const integer &lhs, const integer &rhs) { return compare(lhs, rhs) >= 0; }
+
+		friend bool operator==(const integer &lhs, const long long int rhs) { return cint_compare_si(&lhs.num, rhs) == 0; }
+
+		friend bool operator!=(const integer &lhs, const long long int rhs) { return cint_compare_si(&lhs.num, rhs) != 0; }
+
+		friend bool operator<(const integer &lhs, const long long int rhs) { return cint_compare_si(&lhs.num, rhs) < 0; }
+
+		friend bool operator>(const integer &lhs, const long long int rhs) { return cint_compare_si(&lhs.num, rhs) > 0; }
+
+		friend std::ostream &operator<<(std::ostream &os, const integer &num) { return os << num.str(); }
+	};
+
+	namespace detail {
+		inline cint_sheet *sheet() {
+			// the sheet of the thread (see "cint_thread_sheet"), released with the thread.
+			static thread_local struct holder {
+				~holder() { cint_release_thread_sheet(); }
+			} res;
+			return (void) res, cint_thread_sheet();
+		}
+
+		inline integer &scratch(const size_t depth) {
+			// the numbers used by the nested expressions of the thread (a deque doesn't move them when it grows).
+			static thread_local std::deque<integer> res;
+			if (res.size() <= depth) res.resize(depth + 1);
+			return res[depth];
+		}
+
+		inline const cint *value(const integer &num, size_t) { return num.get(); }
+
+		template<op O, class L, class R>
+		inline const cint *value(const expr<O, L, R> &e, const size_t depth) {
+			integer &res = scratch(depth);
+			return e.eval(res, depth + 1), res.get();
+		}
+
+		inline bool refers(const integer &num, const integer *target) { return &num == target; }
+
+		template<op O, class L, class R>
+		inline bool refers(const expr<O, L, R> &e, const integer *target) { return e.refers(target); }
+
+		inline size_t words(const cint *num) { return num->end - num->mem; }
+
+		template<op O, class L, class R>
+		struct expr {
+			stored<L> l;
+			stored<R> r;
+
+			bool refers(const integer *target) const { return detail::refers(l, target) || detail::refers(r, target); }
+
+			// compute the expression into "res" (which doesn't appear in the expression), the scratch numbers from
+			// "depth" are available.
+			void eval(integer &res, const size_t depth) const {
+				if (O == op::add || O == op::sub) {
+					// the left operand is computed directly into the result.
+					if (is_expr<L>::value) eval_left(res, depth);
+					else res.assign(value(l, depth));
+					const cint *b = value(r, depth);
+					res.reserve(std::max(words(&res.num), words(b)) + 2);
+					O == op::add ? cint_addi(&res.num, b) : cint_subi(&res.num, b);
+				} else {
+					const cint *a = value(l, depth), *b = value(r, depth + 1);
+					if (O == op::mul)
+						res.reserve(words(a) + words(b) + 2), cint_mul(a, b, &res.num);
+					else {
+						integer &other = scratch(depth + 2);
+						res.reserve(words(a) + words(b) + 2), other.reserve(words(a) + words(b) + 2);
+						if (O == op::div) cint_div(sheet(), a, b, &res.num, &other.num);
+						else cint_div(sheet(), a, b, &other.num, &res.num);
+					}
+				}
+			}
+
+		private:
+			template<class T = L>
+			typename std::enable_if<is_expr<T>::value>::type eval_left(integer &res, const size_t depth) const { l.eval(res, depth); }
+
+			template<class T = L>
+			typename std::enable_if<!is_expr<T>::value>::type eval_left(integer &, size_t) const {}
+		};
+	}
+
+	template<class L, class R, class = typename std::enable_if<detail::is_operand<L>::value && detail::is_operand<R>::value>::type>
+	detail::expr<detail::op::add, L, R> operator+(const L &l, const R &r) { return {l, r}; }
+
+	template<class L, class R, class = typename std::enable_if<detail::is_operand<L>::value && detail::is_operand<R>::value>::type>
+	detail::expr<detail::op::sub, L, R> operator-(const L &l, const R &r) { return {l, r}; }
+
+	template<class L, class R, class = typename std::enable_if<detail::is_operand<L>::value && detail::is_operand<R>::value>::type>
+	detail::expr<detail::op::mul, L, R> operator*(const L &l, const R &r) { return {l, r}; }
+
+	template<class L, class R, class = typename std::enable_if<detail::is_operand<L>::value && detail::is_operand<R>::value>::type>
+	detail::expr<detail::op::div, L, R> operator/(const L &l, const R &r) { return {l, r}; }
+
+	template<class L, class R, class = typename std::enable_if<detail::is_operand<L>::value && detail::is_operand<R>::value>::type>
+	detail::expr<detail::op::mod, L, R> operator%(const L &l, const R &r) { return {l, r}; }
+
+	// the advanced functions use the sheet of the thread.
+
+	inline integer pow_mod(const integer &n, const integer &exp, const integer &mod) {
+		integer res;
+		res.reserve(2 * std::max(n.get()->end - n.get()->mem, mod.get()->end - mod.get()->mem) + 2);
+		cint_pow_mod(detail::sheet(), n.get(), exp.get(), mod.get(), res.get());
+		return res;
+	}
+
+	inline integer gcd(const integer &lhs, const integer &rhs) {
+		integer res;
+		res.reserve(std::max(lhs.get()->end - lhs.get()->mem, rhs.get()->end - rhs.get()->mem) + 2);
+		cint_gcd(detail::sheet(), lhs.get(), rhs.get(), res.get());
+		return res;
+	}
+
+	inline integer sqrt(const integer &num) {
+		integer res, rem;
+		res.reserve(num.get()->end - num.get()->mem + 2), rem.reserve(num.get()->end - num.get()->mem + 2);
+		cint_sqrt(detail::sheet(), num.get(), res.get(), rem.get());
+		return res;
+	}
+
+	inline bool is_prime(const integer &num, const int iterations = 16) {
+		static thread_local uint64_t seed = 0x9e3779b97f4a7c15u;
+		return cint_is_prime(detail::sheet(), num.get(), iterations, &seed);
+	}
+
+	inline void swap(integer &lhs, integer &rhs) noexcept { lhs.swap(rhs); }
+}
+
+#endif
@@ -7,13 +7,12 @@ const int prime_generator[] = {1, 1, 1, 1, 5, 7, 7, 11, 23, 17, 11, 1, 29, 67, 1
 
 #define INIT_CINT_ARRAY(SIZE, V_1, V_2, V_3, V_4, V_5, V_6, V_7) \
     cint_sheet * sheet = cint_new_sheet(SIZE); \
-    cint nums[7], *V_1 = nums, *V_2 = nums + 1, *V_3 = nums + 2, *V_4 = nums + 3, *V_5 = nums + 4, *V_6 = nums + 5, *V_7 = nums + 6; \
-    for (int i = 0, j = (int) sizeof(nums) / sizeof(*nums); i < j; ++i) \
-        cint_init(nums + i, SIZE, V_1 == V_2 && V_2 == V_3 && V_3 == V_4 && V_4 == V_5 && V_5 == V_6 && V_6 == V_7);
+    cint_vector *nums = cint_new_vector(7, SIZE); \
+    cint *V_1 = nums->nums, *V_2 = V_1 + 1, *V_3 = V_1 + 2, *V_4 = V_1 + 3, *V_5 = V_1 + 4, *V_6 = V_1 + 5, *V_7 = V_1 + 6; \
+    (void) V_2, (void) V_3, (void) V_4, (void) V_5, (void) V_6, (void) V_7;
 
 #define FREE_CINT_ARRAY() \
-    for (int i = 0, j = (int) sizeof(nums) / sizeof(*nums); i < j; ++i) \
-        free((nums + i)->mem); \
+    cint_clear_vector(nums); \
     cint_clear_sheet(sheet);
 
 int cint_equals(const cint *lhs, const cint *rhs) {
@@ -74,6 +73,12 @@ int test_cint_arithmetic_identities(uint64_t *seed) {
 				if (cint_equals(A, Result2) != 0)
 					return 0 != printf("[ERROR] (A * B) / B != A for a %d-bit value of A and a %d-bit value of B\n", bits_A, bits_B);
 			}
+
+			// Ensures that both GCD algorithms agree
+			cint_gcd(sheet, A, B, Result1);
+			cint_binary_gcd(sheet, A, B, Result2);
+			if (cint_equals(Result1, Result2) != 0)
+				return 0 != printf("[ERROR] The GCD algorithms disagree for a %d-bit value of A and a %d-bit value of B\n", bits_A, bits_B);
 		}
 	}
 
@@ -167,9 +172,34 @@ int test_cint_shifts(uint64_t *seed) {
 	return 0;
 }
 
+struct test_stream {
+	char *str;
+	size_t len, chunks;
+};
+
+static void test_stream_emit(const char *chunk, size_t len, void *data) {
+	struct test_stream *s = (struct test_stream *) data;
+	memcpy(s->str + s->len, chunk, len), s->len += len, ++s->chunks;
+}
+
+static char *to_string_by_division(cint_sheet *sheet, const cint *num, char *buf, const int base) {
+	// the digits by the general division "cint_div", independent of "cint_to_string_buffer" and of "cint_divi_ui".
+	cint A, B, Q, R;
+	cint_init(&A, 4000, 0), cint_init(&B, 64, base), cint_init(&Q, 4000, 0), cint_init(&R, 64, 0);
+	char *end = buf;
+	for (cint_dup(&A, num), A.nat = 1; A.mem != A.end; cint_dup(&A, &Q))
+		cint_div(sheet, &A, &B, &Q, &R), *end++ = cint_alpha[R.mem == R.end ? 0 : *R.mem];
+	if (end == buf) *end++ = '0';
+	if (num->nat < 0) *end++ = '-';
+	*end = 0;
+	for (char t, *z = buf; z < --end; t = *z, *z++ = *end, *end = t);
+	free(A.mem), free(B.mem), free(Q.mem), free(R.mem);
+	return buf;
+}
+
 int test_cint_string_conversion(uint64_t *seed) {
 	cint A;
-	char buf[1024];
+	char buf[1024], alt[1024], by_division[1024];
 	cint_sheet *sheet = cint_new_sheet(4000);
 
 	for (int bits = 1; bits <= 100; bits++) {
@@ -197,11 +227,42 @@ int test_cint_string_conversion(uint64_t *seed) {
 			if (approx_digits == real_digits)
 				printf("[WARNING] Approximation is exact in base %d, the null character that ends the strings could become problematic\n", base);
 
+			// the three conversions are independent, by the words, by "cint_divi_ui" and by "cint_div".
+			A.nat = bits & 1 ? -1 : 1;
+			cint_to_string_buffer(&A, buf, base), cint_to_string_buffer_alt(sheet, &A, alt, base), to_string_by_division(sheet, &A, by_division, base);
+			A.nat = 1;
+			if (strcmp(buf, alt) != 0 || strcmp(buf, by_division) != 0)
+				return 0 != printf("[ERROR] The conversions of a %d-bit number in base %d differ: %s, %s and %s\n", bits, base, buf, alt, by_division);
+
 		}
 
 		free(A.mem);
 	}
 
+	// the streaming conversion must agree with the conversion into a buffer.
+	cint_init(&A, 40000, 0);
+	struct test_stream s = {malloc(40000), 0, 0};
+	for (int bits = 0; bits <= 30000; bits += bits < 600 ? 1 : 997) {
+		for (int base = 2 + bits % 7; base <= 62; base += 7) {
+			if (bits % 3 == 2 && bits < 600) {
+				// a power of the base, or a power of the base minus one, to check the padding with zeros.
+				cint_reinit(&A, 1);
+				while ((int) cint_count_bits(&A) < bits) cint_muli_ui(&A, base);
+				if (bits & 4) cint_subi_ui(&A, 1);
+			} else cint_random_bits(&A, bits, seed);
+			A.nat = bits & 8 ? -1 : 1;
+			s.len = s.chunks = 0;
+			cint_write_stream(sheet, &A, base, test_stream_emit, &s);
+			s.str[s.len] = 0;
+			char *expected = cint_to_string(&A, base);
+			const int ok = strcmp(expected, s.str) == 0 && s.chunks == (s.len + CINT_STREAM_CHUNK - 1) / CINT_STREAM_CHUNK;
+			free(expected);
+			if (!ok)
+				return 0 != printf("[ERROR] The streaming conversion of a %d-bit number in base %d failed\n", bits, base);
+		}
+	}
+	free(s.str), free(A.mem);
+
 	cint_clear_sheet(sheet);
 	return 0;
 }
@@ -236,6 +297,39 @@ int test_cint_random_bits(uint64_t *seed) {
 		}
 	}
 
+	// the xoshiro256** reference outputs, then the streams.
+	static const uint64_t reference[] = {11520, 0, 1509978240, 1215971899390074240};
+	cint_rng rng = {{1, 2, 3, 4}}, other;
+	for (int i = 0; i < 4; ++i)
+		if (cint_rng_next(&rng) != reference[i])
+			return 0 != printf("[ERROR] The output %d of the xoshiro256** generator isn't the reference\n", i);
+	cint_init(&num, 4000, 0), cint_init(&reconstructed, 4000, 0);
+	cint_rng_init(&rng, *seed), other = rng;
+	for (size_t bits = 0; bits <= 2000; bits += 1 + bits / 7) {
+		cint_rng_bits(&num, bits, &rng), cint_rng_bits(&reconstructed, bits, &other);
+		if (cint_count_bits(&num) != bits || cint_equals(&num, &reconstructed) != 0)
+			return 0 != printf("[ERROR] The %zu-bit number of a stream isn't reproducible\n", bits);
+	}
+	cint_rng_jump(&other);
+	for (int i = 0; i < 4; ++i)
+		if (cint_rng_next(&rng) == cint_rng_next(&other))
+			return 0 != printf("[ERROR] The jumped stream repeats the original one\n");
+	// the numbers below a bound are uniform: the counts of the residues of 6 are close to their mean.
+	unsigned counts[6] = {0};
+	cint_reinit(&reconstructed, 6);
+	for (int i = 0; i < 60000; ++i)
+		cint_random_below(&num, &reconstructed, &rng), ++counts[*num.mem];
+	for (int i = 0; i < 6; ++i)
+		if (counts[i] < 9500 || counts[i] > 10500)
+			return 0 != printf("[ERROR] The residue %d was drawn %u times out of 60000\n", i, counts[i]);
+	for (int bits = 1; bits < 1500; bits += 37) {
+		cint_random_bits(&reconstructed, bits, seed), reconstructed.nat = (*seed & 1) ? 1 : -1;
+		for (int i = 0; i < 20; ++i)
+			if (cint_random_below(&num, &reconstructed, &rng), num.nat < 0 || h_cint_compare(&num, &reconstructed) >= 0)
+				return 0 != printf("[ERROR] The random number isn't below the %d-bit bound\n", bits);
+	}
+	free(num.mem), free(reconstructed.mem);
+
 	cint_clear_sheet(sheet);
 	return 0;
 }
@@ -266,6 +360,41 @@ int test_cint_division(uint64_t *seed) {
 			if (R->mem != R->end && R->nat != A->nat)
 				return 0 != printf("[ERROR] The convention is that the sign of R (%ld) is the sign of A (%ld)\n", R->nat, A->nat);
 
+			if (h_cint_compare(R, B) >= 0)
+				return 0 != printf("[ERROR] The remainder isn't smaller than the divisor with A=%d-bit and B=%d-bit\n", bits_A, bits_B);
+
+		}
+	}
+
+	// the long quotients, with divisors full of ones (their quotient words are often over-estimated).
+	for (int bits_A = 200; bits_A <= 3000; bits_A += 97) {
+		for (int bits_B = 33; bits_B < bits_A; bits_B += 61) {
+			cint_random_bits(A, bits_A, seed);
+			if (*seed & 4) cint_reinit(B, 1), cint_left_shifti(B, bits_B), cint_subi_si(B, 1 + (int) (*seed >> 60));
+			else cint_random_bits(B, bits_B, seed);
+			A->nat = (*seed & 1) ? 1 : -1, B->nat = (*seed & 2) ? 1 : -1;
+			cint_div(sheet, A, B, Q, R);
+			cint_mul(B, Q, reconstructed);
+			cint_addi(reconstructed, R);
+			if (cint_equals(A, reconstructed) != 0 || (R->mem != R->end && R->nat != A->nat) || h_cint_compare(R, B) >= 0)
+				return 0 != printf("[ERROR] The long division isn't okay with A=%d-bit and B=%d-bit\n", bits_A, bits_B);
+		}
+	}
+
+	// the exact division and the divisibility, of products then of their neighbours.
+	for (int bits_A = 1; bits_A <= 1500; bits_A += 37) {
+		for (int bits_B = 1; bits_B <= 1500; bits_B += 41) {
+			cint_random_bits(A, bits_A, seed), cint_random_bits(B, bits_B, seed);
+			if (*seed & 8) cint_left_shifti(B, (*seed >> 40) % 70);
+			A->nat = (*seed & 1) ? 1 : -1, B->nat = (*seed & 2) ? 1 : -1;
+			cint_mul(A, B, TMP);
+			if (*seed & 32) cint_dup(Q, TMP), cint_divexact(sheet, Q, B, Q); // in place
+			else cint_divexact(sheet, TMP, B, Q);
+			if (cint_equals(A, Q) != 0 || !cint_is_divisible(sheet, TMP, B))
+				return 0 != printf("[ERROR] The exact division isn't okay with A=%d-bit and B=%d-bit\n", bits_A, bits_B);
+			cint_addi_si(TMP, (*seed & 16) ? 1 : -1), cint_div(sheet, TMP, B, Q, R);
+			if (cint_is_divisible(sheet, TMP, B) != (R->mem == R->end))
+				return 0 != printf("[ERROR] The divisibility isn't okay with A=%d-bit and B=%d-bit\n", bits_A, bits_B);
 		}
 	}
 
@@ -318,13 +447,51 @@ int test_cint_pow_mod(uint64_t *seed) {
 					return 0 != printf(format, "remove", real_bits, real_power);
 			}
 		}
+		// the large multiplicities, the cofactor stays.
+		for (int bits_F = 1; bits_F <= 60; bits_F += 7) {
+			for (int power = 0; power * (bits_F + 1) <= 800; power += 1 + power / 3) {
+				cint_random_bits(Original, bits_F, seed), Original->nat = (*seed & 1) ? 1 : -1;
+				if (cint_count_bits(Original) < 2) cint_reinit(Original, (*seed & 2) ? 3 : -2);
+				cint_random_bits(E, 100, seed), cint_remove(sheet, E, Original), cint_dup(Large, E);
+				cint_reinit(TMP, power), cint_pow(sheet, Original, TMP, Power), cint_mul(Large, Power, TMP);
+				if (power != (int) cint_remove(sheet, TMP, Original) || cint_equals(TMP, E) != 0)
+					return 0 != printf("[ERROR] The remove function failed with a %d-bit factor (power = %d)\n", bits_F, power);
+			}
+		}
+		FREE_CINT_ARRAY();
+	}
+	{
+		// the simultaneous exponentiation agrees with the product of the powers.
+		INIT_CINT_ARRAY(3000, M, Expected, Result, TMP, _, __, ___);
+		cint bases[5], exps[5];
+		for (int i = 0; i < 5; ++i)
+			cint_init(bases + i, 1200, 0), cint_init(exps + i, 1200, 0);
+		for (int bits_M = 2; bits_M <= 700; bits_M += 23) {
+			for (size_t k = 0; k <= 5; ++k) {
+				cint_random_bits(M, bits_M, seed);
+				cint_reinit(Expected, 1);
+				for (size_t i = 0; i < k; ++i) {
+					cint_random_bits(bases + i, 1 + (*seed >> 20) % (2 * bits_M), seed);
+					bases[i].nat = (*seed & 1) ? 1 : -1;
+					if (*seed & 2) cint_random_bits(exps + i, (*seed >> 30) % 800, seed);
+					else cint_reinit(exps + i, (long long int) (*seed >> 40) % 4);
+					cint_pow_mod(sheet, bases + i, exps + i, M, TMP);
+					cint_mul_mod(sheet, Expected, TMP, M, Result), cint_dup(Expected, Result);
+				}
+				cint_multi_pow_mod(sheet, bases, exps, k, M, Result);
+				if (cint_equals(Expected, Result) != 0)
+					return 0 != printf("[ERROR] The simultaneous exponentiation of %zu bases modulo a %d-bit number failed\n", k, bits_M);
+			}
+		}
+		for (int i = 0; i < 5; ++i)
+			free(bases[i].mem), free(exps[i].mem);
 		FREE_CINT_ARRAY();
 	}
 	return 0;
 }
 
 int test_cint_double_roundtrip(uint64_t *seed) {
-	INIT_CINT_ARRAY(1500, A, B, C, D, E, F, G);
+	INIT_CINT_ARRAY(20000, A, B, C, D, E, F, G);
 	double d, e;
 
 	for (int bits = 1; bits <= 1023; bits++) {
@@ -348,6 +515,41 @@ int test_cint_double_roundtrip(uint64_t *seed) {
 
 	}
 
+	// the rounding is to nearest, with the ties to even: the ties and their neighbours are built.
+	for (int bits = 54; bits <= 1100; bits += 3) {
+		for (int round = 0; round < 8; ++round) {
+			const size_t digits = round & 4 ? LDBL_MANT_DIG : DBL_MANT_DIG, ulp = bits - digits;
+			if ((size_t) bits <= digits) continue;
+			cint_random_bits(A, bits, seed), A->nat = (*seed & 8) ? 1 : -1;
+			if (round & 1) cint_right_shifti(A, ulp - 1), cint_set_bit(A, 0, 1), cint_left_shifti(A, ulp - 1); // a tie
+			if (round & 2) cint_addi_si(A, (*seed & 16) ? 1 : -1);
+			if (round & 4) cint_reinit_by_long_double(B, cint_to_long_double(A));
+			else cint_reinit_by_double(B, cint_to_double(A));
+			if (bits >= DBL_MAX_EXP && !(round & 4)) {
+				if (B->mem != B->end)
+					return 0 != printf("[ERROR] The %d-bit number should give an infinity\n", bits);
+				continue;
+			}
+			// |A - B| <= ulp / 2, and an even mantissa for the ties.
+			cint_sub(A, B, C), cint_left_shifti(C, 1), cint_reinit(D, 1), cint_left_shifti(D, ulp);
+			const int cmp = h_cint_compare(C, D);
+			if (cmp > 0 || (cmp == 0 && cint_test_bit(B, ulp)) || (B->mem != B->end && B->nat != A->nat))
+				return 0 != printf("[ERROR] The %d-bit number isn't correctly rounded to %zu digits\n", bits, digits);
+		}
+	}
+
+	// the logarithms read the highest words.
+	for (int bits = 1; bits <= 1400; bits += 7) {
+		cint_random_bits(A, bits, seed);
+		const double l = cint_log2_approx(A);
+		cint_left_shifti(A, 1000);
+		if (l < bits - 1 || l >= bits || cint_log2_approx(A) - 1000 - l > 1e-9 || l - cint_log2_approx(A) + 1000 > 1e-9)
+			return 0 != printf("[ERROR] The binary logarithm of a %d-bit number isn't right (%.17g)\n", bits, l);
+	}
+	cint_reinit(A, 3), d = cint_log2_approx(A) - 1.584962500721156, cint_reinit(A, 10), e = cint_log_approx(A) - 2.302585092994046;
+	if (d > 1e-15 || d < -1e-15 || e > 1e-15 || e < -1e-15)
+		return 0 != printf("[ERROR] The logarithms of 3 and 10 are wrong\n");
+
 	FREE_CINT_ARRAY()
 	return 0;
 }
@@ -374,16 +576,652 @@ int test_cint_is_prime(uint64_t *seed) {
 			if (!cint_is_prime(sheet, P1, -1, seed) || !cint_is_prime(sheet, P2, -1, seed))
 				return 0 != printf("[ERROR] The generated prime number isn't detected as prime at index %d or %d\n", idx1, idx2);
 
+			if (!cint_is_prime_bpsw(sheet, P1) || !cint_is_prime_bpsw(sheet, P2))
+				return 0 != printf("[ERROR] The generated prime number isn't detected as prime by Baillie-PSW at index %d or %d\n", idx1, idx2);
+
 			cint_mul(P1, P2, Product);
 
 			if (cint_is_prime(sheet, Product, -1, seed))
 				return 0 != printf("[ERROR] The product of two prime numbers shouldn't be detected as a prime number\n");
+
+			if (cint_is_prime_bpsw(sheet, Product))
+				return 0 != printf("[ERROR] The product of two prime numbers shouldn't be detected as a prime number by Baillie-PSW\n");
 		}
 	}
+
+	// Compare with the trial division, including the perfect squares and the strong pseudoprimes to base 2.
+	for (int n = 0; n < 200000; ++n) {
+		int expected = n > 1;
+		for (int d = 2; expected && d * d <= n; expected = n % d++ != 0);
+		cint_reinit(P1, n);
+		if (cint_is_prime(sheet, P1, -1, seed) != expected || cint_is_prime_bpsw(sheet, P1) != expected)
+			return 0 != printf("[ERROR] The primality of %d isn't correctly detected\n", n);
+	}
+	const int strong_pseudoprimes[] = {2284453, 3375041, 4181921, 4863127, 5044033, 6233977, 6368689, 6787327};
+	for (int i = 0; i < (int) (sizeof(strong_pseudoprimes) / sizeof(*strong_pseudoprimes)); ++i) {
+		cint_reinit(P1, strong_pseudoprimes[i]);
+		if (cint_is_prime_bpsw(sheet, P1))
+			return 0 != printf("[ERROR] The strong pseudoprime %d passed the Baillie-PSW test\n", strong_pseudoprimes[i]);
+	}
+
+	// Strong pseudoprimes to many prime bases, then a prime below 2^64 and a prime below 2^81, for the witness sets.
+	const char *witness_cases[] = {"3825123056546413051", "318665857834031151167461", "18446744073709551557", "2417851639229258349412301"};
+	for (int i = 0; i < (int) (sizeof(witness_cases) / sizeof(*witness_cases)); ++i) {
+		cint_reinit_by_string(P1, witness_cases[i], 10);
+		if (cint_is_prime(sheet, P1, 1, seed) != (i >= 2) || cint_is_prime_bpsw(sheet, P1) != (i >= 2))
+			return 0 != printf("[ERROR] The primality of %s isn't correctly detected\n", witness_cases[i]);
+	}
+
+	// The generated primes have the requested size, and the next prime is the nearest one.
+	for (int bits = 2; bits <= 200; ++bits) {
+		cint_random_prime(sheet, P1, bits, seed);
+		if ((int) cint_count_bits(P1) != bits || !cint_is_prime_bpsw(sheet, P1))
+			return 0 != printf("[ERROR] The random prime number of %d bits isn't correct\n", bits);
+		cint_next_prime(sheet, P1, P2, seed);
+		if (bits <= 32) {
+			cint_reinit(TMP, 1);
+			for (cint_add(P1, TMP, Product); cint_compare(Product, P2) < 0; cint_addi(Product, TMP))
+				if (cint_is_prime_bpsw(sheet, Product))
+					return 0 != printf("[ERROR] The next prime number after a %d-bit prime missed a prime\n", bits);
+		}
+		if (cint_compare(P1, P2) >= 0 || !cint_is_prime_bpsw(sheet, P2))
+			return 0 != printf("[ERROR] The next prime number after a %d-bit prime isn't correct\n", bits);
+	}
+	FREE_CINT_ARRAY()
+	return 0;
+}
+
+int test_cint_word_operands(uint64_t *seed) {
+	INIT_CINT_ARRAY(2000, A, W, Expected, Result, Q, R, TMP);
+
+	for (int bits_A = 0; bits_A <= 200; ++bits_A) {
+		for (int bits_W = 1; bits_W <= 64; ++bits_W) {
+
+			if (bits_A) {
+				cint_random_bits(A, bits_A, seed);
+				A->nat = (*seed & 1) ? 1 : -1;
+			} else
+				cint_erase(A);
+			cint_random_bits(W, bits_W, seed);
+			const uint64_t w = (uint64_t) *W->mem | (uint64_t) W->mem[1] << cint_exponent | (uint64_t) W->mem[2] << 2 * cint_exponent;
+			const int64_t s = (int64_t) (w >> 1) * ((*seed & 2) ? 1 : -1);
+
+			cint_add(A, W, Expected), cint_add_ui(A, w, Result);
+			if (cint_equals(Expected, Result) != 0)
+				return 0 != printf("[ERROR] The addition of a %d-bit word to a %d-bit number failed\n", bits_W, bits_A);
+
+			cint_sub(A, W, Expected), cint_sub_ui(A, w, Result);
+			if (cint_equals(Expected, Result) != 0)
+				return 0 != printf("[ERROR] The subtraction of a %d-bit word from a %d-bit number failed\n", bits_W, bits_A);
+
+			cint_mul(A, W, Expected), cint_mul_ui(A, w, Result);
+			if (cint_equals(Expected, Result) != 0)
+				return 0 != printf("[ERROR] The multiplication of a %d-bit number by a %d-bit word failed\n", bits_A, bits_W);
+
+			cint_div(sheet, A, W, Q, R);
+			uint64_t r = cint_div_ui(A, w, Result);
+			cint_dup(TMP, R), TMP->nat = 1;
+			if (cint_equals(Q, Result) != 0 || (R->mem != R->end && R->nat != A->nat) || cint_compare_ui(TMP, r) != 0)
+				return 0 != printf("[ERROR] The division of a %d-bit number by a %d-bit word failed\n", bits_A, bits_W);
+
+			r = cint_mod_ui(A, w);
+			if (A->nat < 0 && R->mem != R->end) cint_addi(R, W);
+			if (cint_compare_ui(R, r) != 0)
+				return 0 != printf("[ERROR] The modulo of a %d-bit number by a %d-bit word failed\n", bits_A, bits_W);
+
+			int cmp = cint_compare(A, W);
+			if ((0 < cmp) - (cmp < 0) != cint_compare_ui(A, w))
+				return 0 != printf("[ERROR] The comparison of a %d-bit number with a %d-bit word failed\n", bits_A, bits_W);
+
+			cint_reinit(TMP, s);
+			cmp = cint_compare(A, TMP);
+			if ((0 < cmp) - (cmp < 0) != cint_compare_si(A, s) || cint_compare_si(TMP, s) != 0)
+				return 0 != printf("[ERROR] The comparison of a %d-bit number with a signed word failed\n", bits_A);
+
+			cint_dup(Result, A), cint_addi_si(Result, s), cint_subi_si(Result, s);
+			cint_muli_si(Result, s);
+			cint_mul(A, TMP, Expected);
+			if (cint_equals(Expected, Result) != 0)
+				return 0 != printf("[ERROR] The operations of a %d-bit number with a signed word failed\n", bits_A);
+
+			// the fused multiply-accumulate, on numbers close to the product (the sign often changes).
+			cint_mul(A, W, TMP), cint_dup(Result, TMP), cint_addi_si(Result, s), cint_dup(Expected, Result);
+			cint_addmul_ui(Result, A, w), cint_addi(Expected, TMP);
+			if (cint_equals(Expected, Result) != 0)
+				return 0 != printf("[ERROR] The fused multiply-add of a %d-bit number by a %d-bit word failed\n", bits_A, bits_W);
+			cint_subi(Expected, TMP), cint_subi(Expected, TMP), cint_submul_ui(Result, A, w), cint_submul_ui(Result, A, w);
+			if (cint_equals(Expected, Result) != 0)
+				return 0 != printf("[ERROR] The fused multiply-subtract of a %d-bit number by a %d-bit word failed\n", bits_A, bits_W);
+			cint_random_bits(Q, 1 + (*seed >> 20) % 300, seed), Q->nat = (*seed & 4) ? 1 : -1;
+			cint_mul(A, Q, TMP), cint_dup(Expected, R), cint_dup(Result, R);
+			cint_addi(Expected, TMP), cint_addmul(Result, A, Q);
+			if (cint_equals(Expected, Result) != 0)
+				return 0 != printf("[ERROR] The fused multiply-add of a %d-bit number failed\n", bits_A);
+			cint_subi(Expected, TMP), cint_subi(Expected, TMP), cint_submul(Result, A, Q), cint_submul(Result, A, Q);
+			if (cint_equals(Expected, Result) != 0)
+				return 0 != printf("[ERROR] The fused multiply-subtract of a %d-bit number failed\n", bits_A);
+
+			if (bits_W <= 40 && bits_A <= 40) {
+				cint_reinit(TMP, bits_A);
+				cint_pow(sheet, W, TMP, Expected);
+				cint_ui_pow_ui(Result, w, bits_A);
+				if (cint_equals(Expected, Result) != 0)
+					return 0 != printf("[ERROR] The power of a %d-bit word failed\n", bits_W);
+			}
+
+			if (bits_W > 1 && bits_A > 1) {
+				cint_reinit(TMP, bits_A);
+				cint_pow_mod(sheet, A, W, TMP, Expected);
+				if (Expected->nat < 0) cint_addi(Expected, TMP);
+				cint_reinit(Result, (long long) cint_pow_mod_ui(A, W, bits_A));
+				if (cint_equals(Expected, Result) != 0)
+					return 0 != printf("[ERROR] The power modulo a word of a %d-bit number failed\n", bits_A);
+			}
+		}
+	}
+
+	FREE_CINT_ARRAY()
+	return 0;
+}
+
+int test_cint_batch(uint64_t *seed) {
+	INIT_CINT_ARRAY(1200, M, Expected, Q, R, TMP, TMP_2, TMP_3);
+	enum { N = 11 };
+	cint_vector *operands = cint_new_vector(3 * N, 1200);
+	cint *lhs = operands->nums, *rhs = lhs + N, *res = rhs + N;
+
+	for (int bits_M = 1; bits_M <= 540; bits_M += 7) {
+		for (int n = 0; n <= N; n += 1 + (bits_M & 3)) {
+			cint_random_bits(M, bits_M, seed);
+			*M->mem |= 1;
+			for (int i = 0; i < n; ++i) {
+				cint_random_bits(lhs + i, 1 + *seed % (bits_M + 40), seed);
+				lhs[i].nat = (*seed & 1) ? 1 : -1;
+				cint_random_bits(rhs + i, *seed % (bits_M + 40), seed);
+			}
+
+			cint_mul_mod_batch(sheet, lhs, rhs, M, res, n);
+			for (int i = 0; i < n; ++i) {
+				cint_mul(lhs + i, rhs + i, TMP);
+				cint_div(sheet, TMP, M, Q, Expected);
+				if (Expected->nat < 0 && Expected->mem != Expected->end) cint_addi(Expected, M);
+				if (cint_equals(Expected, res + i) != 0)
+					return 0 != printf("[ERROR] The batch multiplication modulo a %d-bit number failed\n", bits_M);
+			}
+
+			cint_pow_mod_batch(sheet, lhs, rhs, M, res, n);
+			for (int i = 0; i < n; ++i) {
+				cint_erase(TMP_2), *TMP_2->end++ = 1;
+				cint_div(sheet, lhs + i, M, Q, TMP);
+				for (size_t bit = cint_count_bits(rhs + i); bit--;) {
+					cint_mul(TMP_2, TMP_2, TMP_3), cint_div(sheet, TMP_3, M, Q, TMP_2);
+					if (rhs[i].mem[bit / cint_exponent] >> bit % cint_exponent & 1)
+						cint_mul(TMP_2, TMP, TMP_3), cint_div(sheet, TMP_3, M, Q, TMP_2);
+				}
+				cint_div(sheet, TMP_2, M, Q, Expected);
+				if (Expected->nat < 0 && Expected->mem != Expected->end) cint_addi(Expected, M);
+				if (cint_equals(Expected, res + i) != 0)
+					return 0 != printf("[ERROR] The batch power modulo a %d-bit number failed\n", bits_M);
+			}
+		}
+	}
+
+	cint_clear_vector(operands);
+
+	// the vectors of varying capacities are filled in bulk, the views don't overlap.
+	for (size_t n = 1; n <= 300; n += 37) {
+		size_t bits[300];
+		for (size_t i = 0; i < n; ++i) bits[i] = 1 + (i * 7919 + (*seed >> 20)) % 2000;
+		cint_vector *vec = cint_new_vector_varying(n, bits);
+		for (size_t i = 0; i < n; ++i) {
+			cint_random_bits(vec->nums + i, bits[i], seed);
+			if (cint_count_bits(vec->nums + i) != bits[i] || (i && vec->nums[i - 1].mem + vec->nums[i - 1].size > vec->nums[i].mem))
+				return 0 != printf("[ERROR] The number %zu of a vector of %zu numbers doesn't hold its %zu bits\n", i, n, bits[i]);
+		}
+		cint_vector_random_bits(vec, 1, seed);
+		for (size_t i = 0; i < n; ++i)
+			if (vec->nums[i].end != vec->nums[i].mem + 1 || *vec->nums[i].mem != 1 || vec->nums[i].mem[1])
+				return 0 != printf("[ERROR] The bulk random fill of a vector of %zu numbers failed\n", n);
+		cint_clear_vector(vec);
+	}
 	FREE_CINT_ARRAY()
 	return 0;
 }
 
+#define TEST_CINT_FIXED(BITS) \
+	for (int iter = 0; iter < 300; ++iter) { \
+		cint##BITS a, b, m, r; \
+		cint_random_bits(A, 1 + *seed % (BITS), seed), A->nat = (*seed & 1) ? 1 : -1; \
+		cint_random_bits(B, 1 + *seed % (BITS), seed); \
+		cint_random_bits(M, 1 + *seed % (BITS), seed); \
+		if (M->mem == M->end) *M->end++ = 1; \
+		cint##BITS##_from_cint(&a, A), cint##BITS##_from_cint(&b, B), cint##BITS##_from_cint(&m, M); \
+		cint_erase(Expected), *Expected->end++ = 1, cint_left_shifti(Expected, BITS); \
+		cint_div(sheet, A, Expected, Q, R); \
+		if (R->nat < 0 && R->mem != R->end) cint_addi(R, Expected); \
+		cint##BITS##_to_cint(Result, &a); \
+		if (cint_equals(R, Result) != 0) \
+			return 0 != printf("[ERROR] The conversion of a cint%d failed\n", BITS); \
+		cint_dup(A, R); \
+		cint_add(A, B, Expected), cint##BITS##_add(&r, &a, &b), cint##BITS##_from_cint(&a, Expected); \
+		if (cint##BITS##_compare(&r, &a) != 0) \
+			return 0 != printf("[ERROR] The addition of two cint%d failed\n", BITS); \
+		cint##BITS##_from_cint(&a, A); \
+		cint_sub(A, B, Expected), cint##BITS##_sub(&r, &a, &b), cint##BITS##_from_cint(&a, Expected); \
+		if (cint##BITS##_compare(&r, &a) != 0) \
+			return 0 != printf("[ERROR] The subtraction of two cint%d failed\n", BITS); \
+		cint##BITS##_from_cint(&a, A); \
+		cint_mul(A, B, Expected), cint##BITS##_mul(&r, &a, &b), cint##BITS##_from_cint(&a, Expected); \
+		if (cint##BITS##_compare(&r, &a) != 0) \
+			return 0 != printf("[ERROR] The multiplication of two cint%d failed\n", BITS); \
+		cint##BITS##_from_cint(&a, A); \
+		cint_div(sheet, A, M, Q, Expected), cint##BITS##_mod(&r, &a, &m), cint##BITS##_to_cint(Result, &r); \
+		if (cint_equals(Expected, Result) != 0) \
+			return 0 != printf("[ERROR] The modulo of two cint%d failed\n", BITS); \
+		cint_mul_mod(sheet, A, B, M, Expected), cint##BITS##_mul_mod(&r, &a, &b, &m), cint##BITS##_to_cint(Result, &r); \
+		if (cint_equals(Expected, Result) != 0) \
+			return 0 != printf("[ERROR] The multiplication modulo of two cint%d failed\n", BITS); \
+		if (iter % 10 == 0 && (BITS) <= 1024) { \
+			cint_pow_mod(sheet, A, B, M, R), cint_div(sheet, R, M, Q, Expected); \
+			cint##BITS##_pow_mod(&r, &a, &b, &m), cint##BITS##_to_cint(Result, &r); \
+			if (cint_equals(Expected, Result) != 0) \
+				return 0 != printf("[ERROR] The power modulo of cint%d failed\n", BITS); \
+		} \
+	}
+
+int test_cint_fixed(uint64_t *seed) {
+	INIT_CINT_ARRAY(10000, A, B, M, Expected, Result, Q, R);
+	TEST_CINT_FIXED(128)
+	TEST_CINT_FIXED(256)
+	TEST_CINT_FIXED(512)
+	TEST_CINT_FIXED(1024)
+	TEST_CINT_FIXED(4096)
+	FREE_CINT_ARRAY()
+	return 0;
+}
+
+int test_cint_thread_sheet(uint64_t *seed) {
+	INIT_CINT_ARRAY(3000, A, B, M, Expected, Result, Q, R);
+	size_t sizes[10];
+	h_cint_t *mems[10];
+	const uint64_t start = *seed;
+
+	for (int round = 0; round < 2; ++round) {
+		*seed = start;
+		for (int bits = 8; bits <= 1000; bits += 31) {
+			cint_random_bits(A, bits, seed), cint_random_bits(B, 1 + bits / 2, seed), cint_random_bits(M, bits, seed);
+			*M->mem |= 1, *B->mem |= 1;
+
+			cint_div(sheet, A, B, Expected, R), cint_div_auto(A, B, Result, Q);
+			if (cint_equals(Expected, Result) != 0 || cint_equals(R, Q) != 0)
+				return 0 != printf("[ERROR] The automatic division of %d-bit numbers failed\n", bits);
+
+			cint_pow_mod(sheet, A, B, M, Expected), cint_pow_mod_auto(A, B, M, Result);
+			if (cint_equals(Expected, Result) != 0)
+				return 0 != printf("[ERROR] The automatic power modulo of %d-bit numbers failed\n", bits);
+
+			cint_gcd(sheet, A, B, Expected), cint_gcd_auto(A, B, Result);
+			if (cint_equals(Expected, Result) != 0)
+				return 0 != printf("[ERROR] The automatic GCD of %d-bit numbers failed\n", bits);
+
+			cint_binary_gcd_auto(A, B, Result);
+			if (cint_equals(Expected, Result) != 0 || cint_jacobi(sheet, A, M) != cint_jacobi_auto(A, M))
+				return 0 != printf("[ERROR] The automatic binary GCD or Jacobi symbol of %d-bit numbers failed\n", bits);
+
+			cint_sqrt(sheet, A, Expected, R), cint_sqrt_auto(A, Result, Q);
+			if (cint_equals(Expected, Result) != 0 || cint_equals(R, Q) != 0)
+				return 0 != printf("[ERROR] The automatic square root of a %d-bit number failed\n", bits);
+
+			if (cint_is_prime(sheet, M, 4, seed) != cint_is_prime_auto(M, 4, seed))
+				return 0 != printf("[ERROR] The automatic primality test of a %d-bit number failed\n", bits);
+		}
+		// the sheet of the thread reached its high-water mark, the second round must not allocate.
+		cint_sheet *auto_sheet = cint_thread_sheet();
+		for (int i = 0; i < 10; ++i)
+			if (round == 0)
+				sizes[i] = auto_sheet->temp[i].size, mems[i] = auto_sheet->temp[i].mem;
+			else if (sizes[i] != auto_sheet->temp[i].size || mems[i] != auto_sheet->temp[i].mem)
+				return 0 != printf("[ERROR] The sheet of the thread grew again for the same operands\n");
+	}
+
+	cint_release_thread_sheet();
+	FREE_CINT_ARRAY()
+	return 0;
+}
+
+int test_cint_accumulator(uint64_t *seed) {
+	INIT_CINT_ARRAY(4000, A, B, Expected, Result, TMP, _, __);
+	cint_accumulator *acc = cint_new_accumulator(4000);
+
+	// the default room, then small rooms that normalize the words often.
+	for (int round = 0; round < 4; ++round) {
+		if (round) acc->room = 3 + 11 * round;
+		cint_acc_reset(acc), cint_erase(Expected);
+		for (int step = 1; step <= 400; ++step) {
+			cint_random_bits(A, 1 + (*seed >> 16) % 1500, seed), cint_random_bits(B, 1 + (*seed >> 16) % 1500, seed);
+			A->nat = (*seed & 1) ? 1 : -1, B->nat = (*seed & 2) ? 1 : -1;
+			switch (*seed >> 8 & 3) {
+				case 0: cint_acc_add(acc, A), cint_addi(Expected, A); break;
+				case 1: cint_acc_sub(acc, A), cint_subi(Expected, A); break;
+				case 2: cint_acc_addmul(acc, A, B), cint_mul(A, B, TMP), cint_addi(Expected, TMP); break;
+				default: cint_acc_submul(acc, A, B), cint_mul(A, B, TMP), cint_subi(Expected, TMP);
+			}
+			if (step % 37 == 0 || step == 400) {
+				cint_acc_get(acc, Result);
+				if (cint_equals(Expected, Result) != 0)
+					return 0 != printf("[ERROR] The accumulator sum isn't correct after %d steps (room %llu)\n", step, (unsigned long long) acc->room);
+			}
+		}
+	}
+
+	cint_clear_accumulator(acc);
+	FREE_CINT_ARRAY()
+	return 0;
+}
+
+int test_cint_crt(uint64_t *seed) {
+	INIT_CINT_ARRAY(12000, N, Expected, Result, Q, R, TMP, _);
+	static const size_t counts[] = {1, 2, 3, 7, 50, 160};
+	cint_vector *moduli_vector = cint_new_vector(160, 160), *residues_vector = cint_new_vector(160, 160);
+	cint *moduli = moduli_vector->nums, *residues = residues_vector->nums;
+
+	for (size_t c = 0; c < sizeof(counts) / sizeof(*counts); ++c) {
+		// pairwise coprime moduli: powers of distinct small primes, and random primes larger than them.
+		const size_t n = counts[c];
+		for (size_t i = 0; i < n; ++i)
+			if (i % 3 == 2) cint_random_prime(sheet, moduli + i, 48 + (*seed >> 20) % 100, seed);
+			else cint_ui_pow_ui(moduli + i, cint_small_primes[i], 1 + (unsigned) (*seed >> 30) % 3);
+		cint_crt *crt = cint_crt_build(sheet, moduli, n);
+		for (int round = 0; round < 20; ++round) {
+			// a number is reduced, then rebuilt modulo the product of the moduli.
+			cint_random_bits(N, 1 + (*seed >> 10) % (cint_count_bits(crt->tree) + 300), seed);
+			N->nat = (*seed & 1) ? 1 : -1;
+			cint_crt_reduce(sheet, crt, N, residues);
+			for (size_t i = 0; i < n; ++i) {
+				cint_div(sheet, N, moduli + i, Q, R);
+				if (R->nat < 0 && R->mem != R->end) cint_addi(R, moduli + i);
+				if (cint_equals(R, residues + i) != 0)
+					return 0 != printf("[ERROR] The remainder tree of %zu moduli isn't correct\n", n);
+			}
+			cint_crt_combine(sheet, crt, residues, Result);
+			cint_div(sheet, N, crt->tree, Q, Expected);
+			if (Expected->nat < 0 && Expected->mem != Expected->end) cint_addi(Expected, crt->tree);
+			if (cint_equals(Expected, Result) != 0)
+				return 0 != printf("[ERROR] The CRT reconstruction of %zu moduli isn't correct\n", n);
+		}
+		cint_clear_crt(crt);
+	}
+
+	cint_clear_vector(moduli_vector), cint_clear_vector(residues_vector);
+	FREE_CINT_ARRAY()
+	return 0;
+}
+
+int test_cint_sqrt_mod(uint64_t *seed) {
+	INIT_CINT_ARRAY(2000, A, P, N, Root, TMP, Q, R);
+	for (int round = 0; round < 300; ++round) {
+		// a prime, and sometimes a prime p = k * 2 ** s + 1 whose large s leads to the Cipolla algorithm.
+		const int bits = 2 + round % 250;
+		if (round % 5 == 4 && bits > 40) {
+			do {
+				cint_random_bits(P, bits / 3, seed), cint_left_shifti(P, bits - bits / 3), *P->mem |= 1;
+			} while (!cint_is_prime(sheet, P, 0, seed));
+		} else cint_random_prime(sheet, P, bits, seed);
+		for (int i = 0; i < 8; ++i) {
+			cint_random_bits(A, 1 + (*seed >> 30) % (2 * bits), seed);
+			A->nat = (*seed & 1) ? 1 : -1;
+			if (i == 0) cint_erase(A);
+			const int found = cint_sqrt_mod(sheet, A, P, Root);
+			cint_div(sheet, A, P, Q, R);
+			if (R->nat < 0 && R->mem != R->end) cint_addi(R, P);
+			if (*P->mem & 1) {
+				// the Legendre symbol agrees with the criterion of Euler, a ** ((p - 1) / 2) = 1, -1 or 0 (mod p).
+				const int symbol = cint_jacobi(sheet, A, P);
+				cint_dup(N, P), cint_right_shifti(N, 1), cint_pow_mod(sheet, R, N, P, TMP);
+				cint_addi_ui(TMP, 1);
+				const int euler = R->mem == R->end ? 0 : cint_compare_ui(TMP, 2) == 0 ? 1 : cint_compare(TMP, P) == 0 ? -1 : 2;
+				if (symbol != euler)
+					return 0 != printf("[ERROR] The Legendre symbol modulo a %d-bit prime isn't correct\n", bits);
+				if (found != (symbol >= 0))
+					return 0 != printf("[ERROR] The modular square root of a %d-bit prime didn't find a root\n", bits);
+			}
+			if (found) {
+				cint_mul_mod(sheet, Root, Root, P, TMP), cint_dup(N, P), cint_subi(N, Root);
+				if (cint_equals(TMP, R) != 0 || cint_compare(Root, N) > 0)
+					return 0 != printf("[ERROR] The modular square root of a %d-bit prime isn't correct\n", bits);
+			}
+		}
+	}
+	// a perfect square modulus has no quadratic non-residue, the searches stop and the roots found are correct.
+	for (int bits = 2; bits < 200; bits += 3) {
+		bits == 2 ? cint_reinit(N, 3) : cint_random_prime(sheet, N, bits, seed);
+		cint_mul(N, N, P);
+		for (int i = 0; i < 8 && (*P->mem & 1); ++i) {
+			i < 4 ? cint_reinit(A, (i + 2) * (i + 2)) : cint_random_bits(A, 1 + 2 * bits, seed);
+			if (cint_sqrt_mod(sheet, A, P, Root)) {
+				cint_mul_mod(sheet, Root, Root, P, TMP), cint_div(sheet, A, P, Q, R);
+				if (cint_equals(TMP, R) != 0)
+					return 0 != printf("[ERROR] The modular square root modulo the square of a %d-bit prime isn't correct\n", bits);
+			}
+		}
+	}
+
+	// the Jacobi symbol is multiplicative in its denominator.
+	for (int bits = 3; bits < 600; bits += 7) {
+		cint_random_bits(P, bits, seed), cint_random_bits(N, 1 + bits / 2, seed), *P->mem |= 1, *N->mem |= 1;
+		cint_random_bits(A, 1 + (*seed >> 30) % (2 * bits), seed), A->nat = (*seed & 1) ? 1 : -1;
+		cint_mul(P, N, TMP);
+		if (cint_jacobi(sheet, A, P) * cint_jacobi(sheet, A, N) != cint_jacobi(sheet, A, TMP))
+			return 0 != printf("[ERROR] The Jacobi symbol of a %d-bit number isn't multiplicative\n", bits);
+	}
+	FREE_CINT_ARRAY()
+	return 0;
+}
+
+int test_cint_table(uint64_t *seed) {
+	INIT_CINT_ARRAY(800, Key, TMP, _, __, ___, ____, _____);
+	// the keys (2i + 1) * 2^(i % 300) are distinct, some are negative, and zero is a key.
+	const size_t n = 200000;
+	cint_table *table = cint_new_table(1000);
+	for (size_t i = 0; i <= n; ++i) {
+		i < n ? cint_reinit(Key, (long long) (2 * i + 1)), cint_left_shifti(Key, i % 300) : cint_erase(Key);
+		if (i % 3 == 0) cint_negate(Key);
+		if (cint_table_put(table, Key, i) != 1)
+			return 0 != printf("[ERROR] The key %zu was already in the hash table\n", i);
+	}
+	for (size_t i = 0; i <= n; i += 1 + (*seed >> 60)) {
+		i < n ? cint_reinit(Key, (long long) (2 * i + 1)), cint_left_shifti(Key, i % 300) : cint_erase(Key);
+		if (i % 3 == 0) cint_negate(Key);
+		if (i % 5 == 0 && cint_table_put(table, Key, 2 * i) != 0)
+			return 0 != printf("[ERROR] The key %zu was added twice to the hash table\n", i);
+		const uint64_t *value = cint_table_find(table, Key);
+		if (value == 0 || *value != (i % 5 ? i : 2 * i))
+			return 0 != printf("[ERROR] The value of the key %zu isn't in the hash table\n", i);
+		// the same words with the other sign, or shifted, aren't keys.
+		cint_dup(TMP, Key), cint_negate(TMP);
+		if (i < n && cint_table_find(table, TMP))
+			return 0 != printf("[ERROR] The opposite of the key %zu is in the hash table\n", i);
+		cint_left_shifti(TMP, 300);
+		if (i < n && cint_table_find(table, TMP))
+			return 0 != printf("[ERROR] A multiple of the key %zu is in the hash table\n", i);
+		cint_random_bits(TMP, 20 + (*seed >> 50) % 600, seed), *TMP->mem |= 1; // an odd number above the keys
+		if (cint_table_find(table, TMP))
+			return 0 != printf("[ERROR] A random number is in the hash table\n");
+	}
+	if (table->n != n + 1)
+		return 0 != printf("[ERROR] The hash table counts %zu entries instead of %zu\n", table->n, n + 1);
+	cint_clear_table(table);
+	FREE_CINT_ARRAY();
+	return 0;
+}
+
+int test_cint_bitwise(uint64_t *seed) {
+	INIT_CINT_ARRAY(3000, A, B, And, Or, Xor, TMP, _);
+	// the machine words are the reference for the two's complement.
+	for (int i = 0; i < 20000; ++i) {
+		cint_random_bits(A, (*seed >> 20) % 62, seed), A->nat = (*seed & 1) && A->mem != A->end ? -1 : 1;
+		cint_random_bits(B, (*seed >> 20) % 62, seed), B->nat = (*seed & 2) && B->mem != B->end ? -1 : 1;
+		const int64_t a = cint_to_int(A), b = cint_to_int(B);
+		const size_t bit = (*seed >> 40) % 70;
+		cint_and(A, B, And), cint_or(A, B, Or), cint_xor(A, B, Xor), cint_not(A, TMP);
+		if (cint_to_int(And) != (a & b) || cint_to_int(Or) != (a | b) || cint_to_int(Xor) != (a ^ b) || cint_to_int(TMP) != ~a)
+			return 0 != printf("[ERROR] The bitwise operations failed with %lld and %lld\n", (long long) a, (long long) b);
+		if (cint_test_bit(A, bit) != (int) (bit < 63 ? a >> bit & 1 : a < 0))
+			return 0 != printf("[ERROR] The bit %zu of %lld is wrong\n", bit, (long long) a);
+		if (bit < 62) {
+			const int64_t expected = *seed & 4 ? a | (int64_t) 1 << bit : a & ~((int64_t) 1 << bit);
+			cint_set_bit(A, bit, *seed & 4);
+			if (cint_to_int(A) != expected)
+				return 0 != printf("[ERROR] The set bit %zu of %lld is wrong\n", bit, (long long) a);
+		}
+	}
+	// the large numbers verify the identities, in place.
+	for (int bits_A = 1; bits_A < 2500; bits_A += 53)
+		for (int bits_B = 1; bits_B < 2500; bits_B += 71) {
+			cint_random_bits(A, bits_A, seed), A->nat = (*seed & 1) ? -1 : 1;
+			cint_random_bits(B, bits_B, seed), B->nat = (*seed & 2) ? -1 : 1;
+			if (*seed & 4) cint_left_shifti(A, 100), cint_left_shifti(B, 200); // long runs of zeros for the carries.
+			cint_and(A, B, And), cint_or(A, B, Or), cint_dup(Xor, A), cint_xor(Xor, B, Xor);
+			cint_add(And, Or, TMP), cint_subi(TMP, A), cint_subi(TMP, B); // (a & b) + (a | b) = a + b
+			if (TMP->mem != TMP->end)
+				return 0 != printf("[ERROR] The bitwise identity failed with %d-bit and %d-bit numbers\n", bits_A, bits_B);
+			cint_sub(Or, And, TMP); // (a | b) - (a & b) = a ^ b
+			if (cint_compare(TMP, Xor) != 0)
+				return 0 != printf("[ERROR] The exclusive or failed with %d-bit and %d-bit numbers\n", bits_A, bits_B);
+			for (size_t bit = (*seed >> 30) % 200; bit < (size_t) bits_A + 300; bit += 1 + (*seed >> 50) % 40) {
+				const int x = cint_test_bit(A, bit), y = cint_test_bit(B, bit);
+				if (cint_test_bit(And, bit) != (x & y) || cint_test_bit(Or, bit) != (x | y) || cint_test_bit(Xor, bit) != (x ^ y))
+					return 0 != printf("[ERROR] The bit %zu of the bitwise operations is wrong\n", bit);
+			}
+			// the scan visits the set bits, positive numbers count them.
+			size_t ones = 0, bit = cint_scan1(A, 0), previous = 0;
+			for (; bit != SIZE_MAX && bit < (size_t) bits_A + 300; previous = bit + 1, bit = cint_scan1(A, bit + 1), ++ones)
+				for (size_t k = previous; k <= bit; ++k)
+					if (cint_test_bit(A, k) != (k == bit))
+						return 0 != printf("[ERROR] The scan of a %d-bit number missed the bit %zu\n", bits_A, k);
+			if (A->nat > 0 && (bit != SIZE_MAX || ones != cint_popcount(A)))
+				return 0 != printf("[ERROR] The population count of a %d-bit number is wrong\n", bits_A);
+		}
+	FREE_CINT_ARRAY();
+	return 0;
+}
+
+#ifdef CINT_INSTRUMENT
+
+static void test_hook_begin(void *data, int stat, size_t words) { ((size_t *) data)[stat] += words; }
+
+static void test_hook_end(void *data, int stat, uint64_t cycles) { (void) cycles, ++((size_t *) data)[CINT_STAT_COUNT + stat]; }
+
+int test_cint_instrumentation(uint64_t *seed) {
+	INIT_CINT_ARRAY(3000, A, B, M, Q, R, TMP, TMP_2);
+	size_t hooks[2 * CINT_STAT_COUNT] = {0};
+	cint_reset_stats(sheet);
+	cint_set_hooks(sheet, test_hook_begin, test_hook_end, hooks);
+
+	for (int i = 0; i < 100; ++i) {
+		cint_random_bits(A, 2000, seed), cint_random_bits(B, 1000, seed), cint_random_bits(M, 640, seed);
+		cint_div(sheet, A, B, Q, R);
+		cint_pow_mod(sheet, B, M, M, TMP);
+		cint_gcd(sheet, A, B, TMP_2);
+	}
+	const cint_stats *s = &sheet->stats;
+	if (s->calls[CINT_STAT_POW_MOD] != 100 || s->calls[CINT_STAT_GCD] != 100 || s->calls[CINT_STAT_DIV] < 100 + 100 * 640 || s->calls[CINT_STAT_DIV_STEP] < 100)
+		return 0 != printf("[ERROR] The instrumentation counted unexpected calls\n");
+	if (s->sizes[CINT_STAT_GCD][6] != 100 || s->sizes[CINT_STAT_POW_MOD][4] != 100 || s->cycles[CINT_STAT_POW_MOD] == 0)
+		return 0 != printf("[ERROR] The instrumentation histogram isn't correct\n");
+	for (int i = 0; i < CINT_STAT_COUNT; ++i)
+		if (hooks[CINT_STAT_COUNT + i] != s->calls[i] - (i == CINT_STAT_DIV_STEP) * s->calls[i])
+			return 0 != printf("[ERROR] The instrumentation hooks weren't called for \"%s\"\n", cint_stat_names[i]);
+	if (hooks[CINT_STAT_GCD] != 100 * 65)
+		return 0 != printf("[ERROR] The instrumentation hooks received wrong operand sizes\n");
+
+	FILE *out = tmpfile();
+	if (out) {
+		cint_dump_stats(sheet, out);
+		const long size = ftell(out);
+		fclose(out);
+		if (size <= 0)
+			return 0 != printf("[ERROR] The instrumentation dump is empty\n");
+	}
+	if (cint_thread_sheet()->stats.calls[CINT_STAT_MUL] == 0)
+		return 0 != printf("[ERROR] The multiplications weren't recorded into the sheet of the thread\n");
+
+	cint_set_hooks(sheet, 0, 0, 0);
+	FREE_CINT_ARRAY()
+	return 0;
+}
+
+#endif
+
+#ifdef CINT_THREADS
+
+int test_cint_parallel(uint64_t *seed) {
+	INIT_CINT_ARRAY(300000, A, B, C, Expected, Result, Q, R);
+	cint_pool *pool = cint_new_pool(3, 300000);
+
+	for (int bits = 20000; bits <= 80000; bits += 20000) {
+		cint_random_bits(A, bits, seed);
+		cint_random_bits(B, bits - 5000, seed);
+		cint_random_bits(C, bits - 6000, seed);
+		A->nat = (*seed & 1) ? 1 : -1;
+		B->nat = (*seed & 2) ? 1 : -1;
+
+		// The parallel multiplication gives the same product
+		cint_mul(A, B, Expected);
+		cint_mul_parallel(pool, A, B, Result);
+		if (cint_equals(Expected, Result) != 0)
+			return 0 != printf("[ERROR] The parallel multiplication failed with %d-bit numbers\n", bits);
+
+		// The parallel division of B * A + C by B, having a short then a long quotient
+		for (int quotient_bits = 6000; quotient_bits <= 2 * bits; quotient_bits += 2 * bits - 6000) {
+			cint_random_bits(A, quotient_bits, seed);
+			cint_random_bits(C, bits - 6000, seed);
+			A->nat = (*seed & 4) ? 1 : -1;
+			cint_mul_parallel(pool, B, A, Result);
+			cint_addi(Result, C);
+			cint_div_parallel(pool, Result, B, Q, R);
+			cint_div(sheet, Result, B, Expected, C);
+			if (cint_equals(Q, Expected) != 0 || cint_equals(R, C) != 0)
+				return 0 != printf("[ERROR] The parallel division failed with %d-bit numbers\n", bits);
+		}
+	}
+
+	{
+		// More threads than blocks, with operands allocated to their exact size
+		cint_pool *wide = cint_new_pool(63, 300000);
+		const size_t words = 513;
+		cint_random_bits(A, words * cint_exponent, seed);
+		cint_random_bits(B, words * cint_exponent, seed);
+		cint exact[2];
+		for (int i = 0; i < 2; ++i) {
+			const cint *num = i ? B : A;
+			exact[i].mem = (h_cint_t *) malloc(words * sizeof(h_cint_t));
+			assert(exact[i].mem);
+			memcpy(exact[i].mem, num->mem, words * sizeof(h_cint_t));
+			exact[i].end = exact[i].mem + words, exact[i].nat = num->nat, exact[i].size = words;
+		}
+		cint_mul(A, B, Expected);
+		cint_mul_parallel(wide, exact, exact + 1, Result);
+		free(exact[0].mem), free(exact[1].mem);
+		cint_clear_pool(wide);
+		if (cint_equals(Expected, Result) != 0)
+			return 0 != printf("[ERROR] The parallel multiplication failed with exactly sized operands\n");
+	}
+
+	for (unsigned n = 5000; n <= 20000; n += 5000) {
+		cint_factorial(sheet, n, Expected);
+		cint_factorial_parallel(pool, n, Result);
+		if (cint_equals(Expected, Result) != 0)
+			return 0 != printf("[ERROR] The parallel factorial of %u failed\n", n);
+	}
+
+	cint_clear_pool(pool);
+	FREE_CINT_ARRAY()
+	return 0;
+}
+
+#endif
+
 __attribute__((unused)) void print_factorial(const unsigned factorial_n) {
 	int bits = 2; // Print the factorial.
 	for (unsigned i = 1; i < factorial_n; ++i, ++bits)
@@ -478,7 +1316,7 @@ int main(void) {
 		int status;
 		uint64_t seed;
 		int (*func)(uint64_t *seed);
-	} all_tests[50] = {0};
+	} all_tests[100] = {0};
 
 	const int size_tests = sizeof(all_tests) / sizeof(*all_tests);
 	for (int i = 0; i < size_tests; ++i)
@@ -494,6 +1332,21 @@ int main(void) {
 	all_tests[32] = (struct test) {"Double precision numbers", -1, 0x0e33070e9f503, &test_cint_double_roundtrip};
 	all_tests[36] = (struct test) {"Corner cases", -1, 0xd761de5237, &test_cint_corner_cases};
 	all_tests[40] = (struct test) {"Primality", -1, 0xc157613ee82, &test_cint_is_prime};
+	all_tests[44] = (struct test) {"Machine word operands", -1, 0x3b6f40d2a95c, &test_cint_word_operands};
+	all_tests[48] = (struct test) {"Batch operations", -1, 0x61c88647e5a3, &test_cint_batch};
+	all_tests[52] = (struct test) {"Fixed-width integers", -1, 0x2545f4914f6c, &test_cint_fixed};
+	all_tests[56] = (struct test) {"Automatic sheets", -1, 0x7a3c55d1e9, &test_cint_thread_sheet};
+	all_tests[60] = (struct test) {"Accumulator", -1, 0x1b873593cc9e, &test_cint_accumulator};
+	all_tests[64] = (struct test) {"Chinese remainders", -1, 0x85ebca6b0f3a, &test_cint_crt};
+	all_tests[68] = (struct test) {"Modular square roots", -1, 0xc2b2ae35a1e3, &test_cint_sqrt_mod};
+	all_tests[72] = (struct test) {"Bitwise operations", -1, 0x27d4eb2f1656, &test_cint_bitwise};
+	all_tests[76] = (struct test) {"Hash table", -1, 0x165667b19e37, &test_cint_table};
+#ifdef CINT_INSTRUMENT
+	all_tests[92] = (struct test) {"Instrumentation", -1, 0x4f1bbcdcbfa5, &test_cint_instrumentation};
+#endif
+#ifdef CINT_THREADS
+	all_tests[96] = (struct test) {"Parallel mode", -1, 0x9e2a77c3d1f4, &test_cint_parallel};
+#endif
 
 	int n_success = 0, n_failures = 0;
 	for (int i = 0; i < size_tests; ++i)
@@ -517,3 +1370,5 @@ int main(void) {
 }
 
 // Compilation is done using "gcc -Wall -pedantic -O2 -std=c99 main.c -o demo"
+// The parallel mode is also tested using "gcc -Wall -pedantic -O2 -std=c99 -DCINT_THREADS -pthread main.c -o demo"
+// The instrumentation is also tested using "gcc -Wall -pedantic -O2 -std=c99 -DCINT_INSTRUMENT main.c -o demo"
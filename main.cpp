@@ -0,0 +1,146 @@
+#include "cint.hpp"
+
+#include <cstdio>
+#include <vector>
+
+// The tests of the C++ wrapper, the results of the expressions are compared with the ones of the C functions.
+
+using cint_cpp::integer;
+
+static integer random_integer(const size_t bits, uint64_t *seed) {
+	integer res;
+	res.reserve(bits / cint_exponent + 2), cint_random_bits(res.get(), bits, seed);
+	if (*seed & 1) res.negate();
+	return res;
+}
+
+int test_self_reference(uint64_t *seed) {
+	cint_sheet *sheet = cint_new_sheet(4000);
+	cint expected, other, tmp;
+	cint_init(&expected, 4000, 0), cint_init(&other, 4000, 0), cint_init(&tmp, 4000, 0);
+
+	for (int bits = 1; bits <= 900; bits += 7) {
+		const integer b = random_integer(bits / 2 + 1, seed);
+		integer a = random_integer(bits, seed);
+
+		// a = a * b + a
+		cint_mul(a.get(), b.get(), &expected), cint_addi(&expected, a.get());
+		a = a * b + a;
+		if (cint_compare(a.get(), &expected) != 0)
+			return 0 != printf("[ERROR] The expression a = a * b + a failed with %d-bit numbers\n", bits);
+
+		// a = (a - b) * (b + a) - a
+		cint_sub(a.get(), b.get(), &other), cint_add(b.get(), a.get(), &tmp);
+		cint_mul(&other, &tmp, &expected), cint_subi(&expected, a.get());
+		a = (a - b) * (b + a) - a;
+		if (cint_compare(a.get(), &expected) != 0)
+			return 0 != printf("[ERROR] The expression a = (a - b) * (b + a) - a failed with %d-bit numbers\n", bits);
+
+		// a = a / b then a %= b
+		cint_div(sheet, a.get(), b.get(), &expected, &other);
+		integer r = a;
+		a = a / b, r %= b;
+		if (cint_compare(a.get(), &expected) != 0 || cint_compare(r.get(), &other) != 0)
+			return 0 != printf("[ERROR] The self-referencing division failed with %d-bit numbers\n", bits);
+
+		// a += a, then a -= a
+		cint_add(a.get(), a.get(), &expected);
+		a += a;
+		if (cint_compare(a.get(), &expected) != 0 || (a -= a, a != 0))
+			return 0 != printf("[ERROR] The compound assignment of a to itself failed with %d-bit numbers\n", bits);
+	}
+
+	free(expected.mem), free(other.mem), free(tmp.mem);
+	cint_clear_sheet(sheet);
+	return 0;
+}
+
+int test_moves(uint64_t *seed) {
+	for (int bits = 1; bits <= 2000; bits += 13) {
+		integer a = random_integer(bits, seed), b = random_integer(bits + 40, seed);
+		const integer copy_a = a, copy_b = b;
+		const h_cint_t *mem = a.get()->mem;
+
+		// the move construction takes the memory, the moved-from number can be assigned again.
+		integer c(std::move(a));
+		if (c.get()->mem != mem || c != copy_a)
+			return 0 != printf("[ERROR] The move construction failed with %d-bit numbers\n", bits);
+		a = copy_b * copy_b;
+		if (a != copy_b * copy_b)
+			return 0 != printf("[ERROR] The assignment of a moved-from number failed with %d-bit numbers\n", bits);
+
+		// the move assignment exchanges the memory.
+		b = std::move(c);
+		if (b.get()->mem != mem || b != copy_a)
+			return 0 != printf("[ERROR] The move assignment failed with %d-bit numbers\n", bits);
+
+		// the numbers are moved when a vector grows.
+		std::vector<integer> all;
+		for (int i = 0; i < 40; ++i)
+			all.push_back(copy_a * integer(i));
+		for (int i = 0; i < 40; ++i)
+			if (all[i] != copy_a * integer(i))
+				return 0 != printf("[ERROR] The numbers moved by a vector differ with %d-bit numbers\n", bits);
+	}
+	return 0;
+}
+
+int test_c_api(uint64_t *seed) {
+	cint_sheet *sheet = cint_new_sheet(8000);
+	cint expected, other, tmp;
+	cint_init(&expected, 8000, 0), cint_init(&other, 8000, 0), cint_init(&tmp, 8000, 0);
+
+	for (int bits = 1; bits <= 1500; bits += 11) {
+		const integer a = random_integer(bits, seed), b = random_integer(bits / 3 + 1, seed), c = random_integer(bits * 2, seed);
+
+		// a * b + c - a / b
+		cint_mul(a.get(), b.get(), &expected), cint_addi(&expected, c.get());
+		cint_div(sheet, a.get(), b.get(), &other, &tmp), cint_subi(&expected, &other);
+		integer res = a * b + c - a / b;
+		if (cint_compare(res.get(), &expected) != 0)
+			return 0 != printf("[ERROR] The expression a * b + c - a / b differs from the C functions with %d-bit numbers\n", bits);
+
+		// the string conversion and the advanced functions
+		char *str = cint_to_string(c.get(), 36);
+		const bool same_string = c.str(36) == str && integer(str, 36) == c;
+		free(str);
+		if (!same_string)
+			return 0 != printf("[ERROR] The string conversion differs from the C functions with %d-bit numbers\n", bits);
+
+		integer n = a, mod = b;
+		if (n.sign() < 0) n.negate();
+		if (mod.sign() < 0) mod.negate();
+		if (mod == 0) mod = 7;
+		cint_pow_mod(sheet, n.get(), b.get(), mod.get(), &expected), cint_gcd(sheet, a.get(), c.get(), &other);
+		if (cint_cpp::pow_mod(n, b, mod) != integer(&expected) || cint_cpp::gcd(a, c) != integer(&other))
+			return 0 != printf("[ERROR] The advanced functions differ from the C functions with %d-bit numbers\n", bits);
+		cint_sqrt(sheet, n.get(), &expected, &other);
+		if (cint_cpp::sqrt(n) != integer(&expected))
+			return 0 != printf("[ERROR] The square root differs from the C function with %d-bit numbers\n", bits);
+	}
+
+	free(expected.mem), free(other.mem), free(tmp.mem);
+	cint_clear_sheet(sheet);
+	return 0;
+}
+
+int main() {
+	struct test {
+		const char *name;
+		int (*func)(uint64_t *seed);
+	} all_tests[] = {
+		{"Self-referencing expressions", &test_self_reference},
+		{"Moves", &test_moves},
+		{"Agreement with the C functions", &test_c_api},
+	};
+
+	int success = 0, failures = 0;
+	for (const test &t : all_tests) {
+		uint64_t seed = 0x6a09e667f3bcc909;
+		const int status = t.func(&seed);
+		printf("%45s ... [%s]\n", t.name, status ? "FAIL" : "PASS");
+		status ? ++failures : ++success;
+	}
+	printf("\nCompleted with %d success and %d failures.\n", success, failures);
+	return failures != 0;
+}
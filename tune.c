@@ -0,0 +1,183 @@
+#define _POSIX_C_SOURCE 200112L
+#include <stdio.h>
+#include <time.h>
+#ifdef CINT_THREADS
+#include <unistd.h>
+#endif
+
+// The tuning program times the competing kernels of the library on the host, then it writes the thresholds header
+// on the standard output, the library includes it when compiled with -DCINT_THRESHOLDS:
+//     ./tune > cint-thresholds.h && gcc -O2 -std=c99 -DCINT_THRESHOLDS main.c -o demo
+// Built with -DCINT_THREADS -pthread, it also measures the thresholds of the parallel mode.
+
+// the kernels are timed without their dispatch.
+#define CINT_BINARY_GCD_THRESHOLD ((size_t) -1)
+static size_t tune_div_schoolbook = (size_t) -1 >> 1;
+#define CINT_DIV_SCHOOLBOOK_THRESHOLD tune_div_schoolbook
+#ifdef CINT_THREADS
+// the thresholds are at least 1, the comparisons of the unsigned sizes with them aren't always false (-Wtype-limits).
+#define CINT_PARALLEL_MUL_THRESHOLD 1
+#define CINT_PARALLEL_FACTORIAL_THRESHOLD 1
+#endif
+
+#include "big-num.c"
+
+typedef struct {
+	cint_sheet *sheet;
+	cint *A, *B, *C, *D;
+	cint *bases, *exps, *res;
+	size_t n, window;
+	unsigned factorial_n;
+#ifdef CINT_THREADS
+	cint_pool *pool;
+#endif
+} tune_state;
+
+static double tune_time(void (*func)(tune_state *), tune_state *s) {
+	// the time of a call, repeated during 20 ms at least.
+	size_t n = 0;
+	const clock_t start = clock();
+	clock_t elapsed;
+	do func(s), ++n;
+	while ((elapsed = clock() - start) < CLOCKS_PER_SEC / 50);
+	return (double) elapsed / CLOCKS_PER_SEC / (double) n;
+}
+
+static void run_gcd(tune_state *s) { cint_gcd(s->sheet, s->A, s->B, s->C); }
+
+static void run_binary_gcd(tune_state *s) { cint_binary_gcd(s->sheet, s->A, s->B, s->C); }
+
+static void run_div(tune_state *s) { cint_div(s->sheet, s->A, s->B, s->C, s->D); }
+
+static void run_pow_mod_batch(tune_state *s) { h_cint_pow_mod_batch(s->sheet, s->bases, s->exps, s->C, s->res, s->n, s->window); }
+
+static size_t tune_binary_gcd(tune_state *s, uint64_t *seed) {
+	// the smallest operand size (in words) from which the binary GCD wins at this size and the next two ones.
+	static const size_t sizes[] = {2, 3, 4, 5, 6, 8, 10, 12, 16, 20, 24, 32, 48, 64, 96, 128, 192, 256};
+	const size_t n = sizeof(sizes) / sizeof(*sizes);
+	int wins[sizeof(sizes) / sizeof(*sizes)];
+	for (size_t i = 0; i < n; ++i) {
+		cint_random_bits(s->A, sizes[i] * cint_exponent, seed), cint_random_bits(s->B, sizes[i] * cint_exponent, seed);
+		const double a = tune_time(run_gcd, s), b = tune_time(run_binary_gcd, s);
+		wins[i] = b < a;
+		fprintf(stderr, "gcd: %zu words, euclid %.3g s, binary %.3g s\n", sizes[i], a, b);
+	}
+	for (size_t i = 0; i < n; ++i)
+		if (wins[i] && (i + 1 >= n || wins[i + 1]) && (i + 2 >= n || wins[i + 2]))
+			return sizes[i];
+	return (size_t) 1 << 20;
+}
+
+static size_t tune_div(tune_state *s, uint64_t *seed) {
+	// the smallest quotient size (in words) from which the long division wins at this size and the next two ones.
+	static const size_t sizes[] = {1, 2, 3, 4, 5, 6, 8, 10, 12, 16, 24, 32, 48, 64};
+	const size_t n = sizeof(sizes) / sizeof(*sizes);
+	int wins[sizeof(sizes) / sizeof(*sizes)];
+	for (size_t i = 0; i < n; ++i) {
+		cint_random_bits(s->A, (sizes[i] + 16) * cint_exponent, seed), cint_random_bits(s->B, 16 * cint_exponent, seed);
+		tune_div_schoolbook = (size_t) -1 >> 1;
+		const double a = tune_time(run_div, s);
+		tune_div_schoolbook = 0;
+		const double b = tune_time(run_div, s);
+		wins[i] = b < a;
+		fprintf(stderr, "div: %zu words of quotient, approximation %.3g s, long division %.3g s\n", sizes[i], a, b);
+	}
+	tune_div_schoolbook = (size_t) -1 >> 1;
+	for (size_t i = 0; i < n; ++i)
+		if (wins[i] && (i + 1 >= n || wins[i + 1]) && (i + 2 >= n || wins[i + 2]))
+			return sizes[i];
+	return (size_t) 1 << 20;
+}
+
+static size_t tune_batch_window(tune_state *s, uint64_t *seed) {
+	// the window minimizing the sum of the relative times over the usual sizes of moduli.
+	static const size_t sizes[] = {128, 256, 512, 1024};
+	double score[8] = {0}, times[8];
+	for (size_t i = 0; i < sizeof(sizes) / sizeof(*sizes); ++i) {
+		cint_random_bits(s->C, sizes[i], seed), *s->C->mem |= 1;
+		for (size_t j = 0; j < s->n; ++j)
+			cint_random_bits(s->bases + j, sizes[i], seed), cint_random_bits(s->exps + j, sizes[i], seed);
+		double best = 0;
+		for (s->window = 1; s->window < 8; ++s->window) {
+			times[s->window] = tune_time(run_pow_mod_batch, s);
+			if (best == 0 || times[s->window] < best) best = times[s->window];
+			fprintf(stderr, "batch: %zu bits, window %zu, %.3g s\n", sizes[i], s->window, times[s->window]);
+		}
+		for (size_t w = 1; w < 8; ++w)
+			score[w] += times[w] / best;
+	}
+	size_t res = 1;
+	for (size_t w = 2; w < 8; ++w)
+		if (score[w] < score[res]) res = w;
+	return res;
+}
+
+#ifdef CINT_THREADS
+
+static void run_mul(tune_state *s) { cint_mul(s->A, s->B, s->C); }
+
+static void run_mul_parallel(tune_state *s) { cint_mul_parallel(s->pool, s->A, s->B, s->C); }
+
+static void run_factorial(tune_state *s) { cint_factorial(s->sheet, s->factorial_n, s->D); }
+
+static void run_factorial_parallel(tune_state *s) { cint_factorial_parallel(s->pool, s->factorial_n, s->D); }
+
+static size_t tune_parallel_mul(tune_state *s, uint64_t *seed) {
+	// the product of the operand lengths (in words) from which the parallel multiplication wins.
+	for (size_t words = 64; words <= 4096; words <<= 1) {
+		cint_random_bits(s->A, words * cint_exponent, seed), cint_random_bits(s->B, words * cint_exponent, seed);
+		const double a = tune_time(run_mul, s), b = tune_time(run_mul_parallel, s);
+		fprintf(stderr, "parallel mul: %zu words, serial %.3g s, parallel %.3g s\n", words, a, b);
+		if (b < a) return words * words;
+	}
+	return (size_t) 1 << 40;
+}
+
+static size_t tune_parallel_factorial(tune_state *s) {
+	// the factorial from which the parallel computation wins.
+	for (s->factorial_n = 1024; s->factorial_n <= 65536; s->factorial_n <<= 1) {
+		const double a = tune_time(run_factorial, s), b = tune_time(run_factorial_parallel, s);
+		fprintf(stderr, "parallel factorial: %u, serial %.3g s, parallel %.3g s\n", s->factorial_n, a, b);
+		if (b < a) return s->factorial_n;
+	}
+	return (size_t) 1 << 30;
+}
+
+#endif
+
+int main(void) {
+	uint64_t seed = 0x2545f4914f6cdd1d;
+	enum { N = 16, BITS = 1100000 };
+	cint nums[4], bases[N], exps[N], res[N];
+	tune_state s = {0};
+	for (int i = 0; i < 4; ++i) cint_init(nums + i, BITS, 0);
+	for (int i = 0; i < N; ++i) cint_init(bases + i, 2048, 0), cint_init(exps + i, 2048, 0), cint_init(res + i, 2048, 0);
+	s.sheet = cint_new_sheet(BITS);
+	s.A = nums, s.B = nums + 1, s.C = nums + 2, s.D = nums + 3;
+	s.bases = bases, s.exps = exps, s.res = res, s.n = N;
+
+	const size_t gcd = tune_binary_gcd(&s, &seed), div = tune_div(&s, &seed), window = tune_batch_window(&s, &seed);
+	printf("// The thresholds of the tiny Big Integer Library for this host, generated by \"tune.c\".\n");
+	printf("// The library includes this file when it's compiled with -DCINT_THRESHOLDS.\n\n");
+	printf("#ifndef CINT_BINARY_GCD_THRESHOLD\n#define CINT_BINARY_GCD_THRESHOLD %zu\n#endif\n", gcd);
+	printf("#ifndef CINT_DIV_SCHOOLBOOK_THRESHOLD\n#define CINT_DIV_SCHOOLBOOK_THRESHOLD %zu\n#endif\n", div);
+	printf("#ifndef CINT_BATCH_WINDOW\n#define CINT_BATCH_WINDOW %zu\n#endif\n", window);
+#ifdef CINT_THREADS
+	const long n_threads = sysconf(_SC_NPROCESSORS_ONLN);
+	if (n_threads > 1) {
+		s.pool = cint_new_pool((unsigned) n_threads, BITS);
+		const size_t mul = tune_parallel_mul(&s, &seed), factorial = tune_parallel_factorial(&s);
+		printf("#ifndef CINT_PARALLEL_MUL_THRESHOLD\n#define CINT_PARALLEL_MUL_THRESHOLD %zu\n#endif\n", mul);
+		printf("#ifndef CINT_PARALLEL_FACTORIAL_THRESHOLD\n#define CINT_PARALLEL_FACTORIAL_THRESHOLD %zu\n#endif\n", factorial);
+		cint_clear_pool(s.pool);
+	} else
+		printf("// a single processor is online, the parallel mode keeps its default thresholds.\n");
+#endif
+
+	for (int i = 0; i < 4; ++i) free(nums[i].mem);
+	for (int i = 0; i < N; ++i) free(bases[i].mem), free(exps[i].mem), free(res[i].mem);
+	cint_clear_sheet(s.sheet);
+	return 0;
+}
+
+// Compilation is done using "gcc -O2 -std=c99 tune.c -o tune" (add "-DCINT_THREADS -pthread" for the parallel mode)